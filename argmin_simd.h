@@ -0,0 +1,160 @@
+#ifndef ARGMIN_SIMD_H
+#define ARGMIN_SIMD_H
+
+#include <limits.h>
+
+// ─────────────────────────────────────────────────────────
+// Masked argmin over packed columns
+//
+// Selects the index i with arrival[i] <= now && !done[i] that minimises
+// (key[i], tie[i], i) lexicographically, or -1 if nothing is eligible.
+// That is exactly the "find best among arrived and not completed" scan
+// of the SJF (key = burst, tie = arrival) and priority (key = priority,
+// tie = burst) schedulers, including their tie-breaking rules.
+//
+// AVX2 and SSE4.1 versions are compiled with per-function target
+// attributes, so no global -mavx2 is needed; the best one the CPU
+// supports is picked on the first call.
+// ─────────────────────────────────────────────────────────
+
+typedef int (*ArgminFn)(const int *key, const int *tie, const int *arrival,
+                        const int *done, int n, int now);
+
+static int argmin_select_scalar(const int *key, const int *tie, const int *arrival,
+                                const int *done, int n, int now) {
+    int idx = -1;
+
+    for (int i = 0; i < n; i++) {
+        if (arrival[i] > now || done[i]) continue;
+        if (idx == -1 || key[i] < key[idx] ||
+            (key[i] == key[idx] && tie[i] < tie[idx])) {
+            idx = i;
+        }
+    }
+    return idx;
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARGMIN_HAVE_X86 1
+#include <immintrin.h>
+
+// Each lane keeps its own best (key, tie, index) over a single pass; lanes
+// see indices in increasing order, so a strict "less" keeps the earliest.
+// The lane winners are then reduced with the same rule as the scalar scan.
+static int argmin_reduce_lanes(const int *k, const int *t, const int *ix, int lanes,
+                               const int *key, const int *tie, const int *arrival,
+                               const int *done, int from, int n, int now) {
+    int idx = -1;
+
+    for (int l = 0; l < lanes; l++) {
+        int i = ix[l];
+        if (i < 0) continue;
+        if (idx == -1 || k[l] < key[idx] || (k[l] == key[idx] && t[l] < tie[idx]) ||
+            (k[l] == key[idx] && t[l] == tie[idx] && i < idx)) {
+            idx = i;
+        }
+    }
+    for (int i = from; i < n; i++) {
+        if (arrival[i] > now || done[i]) continue;
+        if (idx == -1 || key[i] < key[idx] ||
+            (key[i] == key[idx] && tie[i] < tie[idx])) {
+            idx = i;
+        }
+    }
+    return idx;
+}
+
+__attribute__((target("sse4.1")))
+static int argmin_select_sse41(const int *key, const int *tie, const int *arrival,
+                               const int *done, int n, int now) {
+    const __m128i vnow = _mm_set1_epi32(now);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i step = _mm_set1_epi32(4);
+    __m128i vidx = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i mk = _mm_set1_epi32(INT_MAX), mt = mk, mi = _mm_set1_epi32(-1);
+    int k[4], t[4], ix[4], i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(arrival + i));
+        __m128i d = _mm_loadu_si128((const __m128i *)(done + i));
+        __m128i kk = _mm_loadu_si128((const __m128i *)(key + i));
+        __m128i tt = _mm_loadu_si128((const __m128i *)(tie + i));
+        __m128i ok = _mm_andnot_si128(_mm_cmpgt_epi32(a, vnow), _mm_cmpeq_epi32(d, zero));
+        __m128i lt = _mm_or_si128(_mm_cmpgt_epi32(mk, kk),
+                                  _mm_and_si128(_mm_cmpeq_epi32(mk, kk), _mm_cmpgt_epi32(mt, tt)));
+        lt = _mm_and_si128(ok, _mm_or_si128(lt, _mm_cmpgt_epi32(zero, mi)));
+        mk = _mm_blendv_epi8(mk, kk, lt);
+        mt = _mm_blendv_epi8(mt, tt, lt);
+        mi = _mm_blendv_epi8(mi, vidx, lt);
+        vidx = _mm_add_epi32(vidx, step);
+    }
+    _mm_storeu_si128((__m128i *)k, mk);
+    _mm_storeu_si128((__m128i *)t, mt);
+    _mm_storeu_si128((__m128i *)ix, mi);
+    return argmin_reduce_lanes(k, t, ix, 4, key, tie, arrival, done, i, n, now);
+}
+
+__attribute__((target("avx2")))
+static int argmin_select_avx2(const int *key, const int *tie, const int *arrival,
+                              const int *done, int n, int now) {
+    const __m256i vnow = _mm256_set1_epi32(now);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i step = _mm256_set1_epi32(8);
+    __m256i vidx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i mk = _mm256_set1_epi32(INT_MAX), mt = mk, mi = _mm256_set1_epi32(-1);
+    int k[8], t[8], ix[8], i;
+
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)(arrival + i));
+        __m256i d = _mm256_loadu_si256((const __m256i *)(done + i));
+        __m256i kk = _mm256_loadu_si256((const __m256i *)(key + i));
+        __m256i tt = _mm256_loadu_si256((const __m256i *)(tie + i));
+        __m256i ok = _mm256_andnot_si256(_mm256_cmpgt_epi32(a, vnow), _mm256_cmpeq_epi32(d, zero));
+        __m256i lt = _mm256_or_si256(_mm256_cmpgt_epi32(mk, kk),
+                                     _mm256_and_si256(_mm256_cmpeq_epi32(mk, kk),
+                                                      _mm256_cmpgt_epi32(mt, tt)));
+        lt = _mm256_and_si256(ok, _mm256_or_si256(lt, _mm256_cmpgt_epi32(zero, mi)));
+        mk = _mm256_blendv_epi8(mk, kk, lt);
+        mt = _mm256_blendv_epi8(mt, tt, lt);
+        mi = _mm256_blendv_epi8(mi, vidx, lt);
+        vidx = _mm256_add_epi32(vidx, step);
+    }
+    _mm256_storeu_si256((__m256i *)k, mk);
+    _mm256_storeu_si256((__m256i *)t, mt);
+    _mm256_storeu_si256((__m256i *)ix, mi);
+    return argmin_reduce_lanes(k, t, ix, 8, key, tie, arrival, done, i, n, now);
+}
+#endif
+
+// Kernel chosen for this CPU, and its name for the logs
+static ArgminFn argmin_resolve(const char **name) {
+#ifdef ARGMIN_HAVE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        if (name) *name = "avx2";
+        return argmin_select_avx2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        if (name) *name = "sse4.1";
+        return argmin_select_sse41;
+    }
+#endif
+    if (name) *name = "scalar";
+    return argmin_select_scalar;
+}
+
+static ArgminFn argmin_fn = 0;
+
+// Pick the kernel now rather than on the first select, which two threads
+// could otherwise make at the same time
+static inline void argmin_init(void) {
+    if (!argmin_fn) argmin_fn = argmin_resolve(0);
+}
+
+static inline int argmin_select(const int *key, const int *tie, const int *arrival,
+                                const int *done, int n, int now) {
+    if (!argmin_fn) argmin_init();
+    return argmin_fn(key, tie, arrival, done, n, now);
+}
+
+#endif
@@ -0,0 +1,181 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "argmin_simd.h"
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <time.h>
+#else
+    #include <unistd.h>
+    #include <sys/time.h>
+#endif
+
+#define MIN_READY 8
+#define MAX_READY 65536
+#define OPS_BUDGET 4000000         // scanned elements per measurement
+#define MAX_BURST 64
+#define MAX_ARRIVAL 1000
+
+// ─────────────────────────────────────────────────────────
+// Steady-state ready-set benchmark: every operation selects the best
+// job and replaces it with a freshly arrived one, i.e. one dispatch of
+// SJF with a ready set of constant size.  The linear kernels scan the
+// packed columns; the heap pays O(log n) per pop + push.
+// ─────────────────────────────────────────────────────────
+
+typedef struct {
+    int *key;
+    int *tie;
+    int *arrival;
+    int *done;
+    int *heap;
+    int n;
+} ReadySet;
+
+double get_time() {
+#ifdef _WIN32
+    return (double)clock() / CLOCKS_PER_SEC;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+#endif
+}
+
+static unsigned int rng_state = 12345;
+
+static int next_random(int bound) {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return (int)((rng_state >> 8) % (unsigned int)bound);
+}
+
+static int job_less(const ReadySet *r, int a, int b) {
+    if (r->key[a] != r->key[b]) return r->key[a] < r->key[b];
+    if (r->tie[a] != r->tie[b]) return r->tie[a] < r->tie[b];
+    return a < b;
+}
+
+static void heap_sift_down(ReadySet *r, int pos) {
+    int *h = r->heap;
+    for (;;) {
+        int l = 2 * pos + 1, rr = l + 1, m = pos, tmp;
+        if (l < r->n && job_less(r, h[l], h[m])) m = l;
+        if (rr < r->n && job_less(r, h[rr], h[m])) m = rr;
+        if (m == pos) return;
+        tmp = h[pos]; h[pos] = h[m]; h[m] = tmp;
+        pos = m;
+    }
+}
+
+static void refill(ReadySet *r, int idx) {
+    r->key[idx] = 1 + next_random(MAX_BURST);
+    r->tie[idx] = next_random(MAX_ARRIVAL);
+}
+
+static void ready_init(ReadySet *r, int n) {
+    r->n = n;
+    r->key = malloc(sizeof(int) * n);
+    r->tie = malloc(sizeof(int) * n);
+    r->arrival = malloc(sizeof(int) * n);
+    r->done = calloc(n, sizeof(int));
+    r->heap = malloc(sizeof(int) * n);
+    for (int i = 0; i < n; i++) {
+        refill(r, i);
+        r->arrival[i] = r->tie[i];
+        r->heap[i] = i;
+    }
+    for (int i = n / 2 - 1; i >= 0; i--) heap_sift_down(r, i);
+}
+
+static void ready_free(ReadySet *r) {
+    free(r->key);
+    free(r->tie);
+    free(r->arrival);
+    free(r->done);
+    free(r->heap);
+}
+
+static double bench_linear(ArgminFn fn, int n, int ops) {
+    ReadySet r;
+    volatile int sink = 0;
+    double start;
+
+    rng_state = 12345;
+    ready_init(&r, n);
+    start = get_time();
+    for (int op = 0; op < ops; op++) {
+        int idx = fn(r.key, r.tie, r.arrival, r.done, n, MAX_ARRIVAL);
+        sink += idx;
+        refill(&r, idx);
+    }
+    double elapsed = get_time() - start;
+    ready_free(&r);
+    (void)sink;
+    return elapsed * 1e9 / ops;
+}
+
+static double bench_heap(int n, int ops) {
+    ReadySet r;
+    volatile int sink = 0;
+    double start;
+
+    rng_state = 12345;
+    ready_init(&r, n);
+    start = get_time();
+    for (int op = 0; op < ops; op++) {
+        // Pop the root and push its replacement: one sift-down
+        int idx = r.heap[0];
+        sink += idx;
+        refill(&r, idx);
+        heap_sift_down(&r, 0);
+    }
+    double elapsed = get_time() - start;
+    ready_free(&r);
+    (void)sink;
+    return elapsed * 1e9 / ops;
+}
+
+int main() {
+    const char *best_name;
+    ArgminFn best = argmin_resolve(&best_name);
+    int crossover = -1;
+
+    printf("========================================\n");
+    printf("  Argmin Selection Benchmark\n");
+    printf("  Linear SIMD scan vs Binary Heap\n");
+    printf("  Runtime kernel: %s\n", best_name);
+    printf("========================================\n\n");
+
+    printf("Ready    Scalar      SSE4.1      AVX2        Heap        Faster\n");
+    printf("=================================================================\n");
+    for (int n = MIN_READY; n <= MAX_READY; n *= 2) {
+        int ops = OPS_BUDGET / n < 2000 ? 2000 : OPS_BUDGET / n;
+        double scalar = bench_linear(argmin_select_scalar, n, ops);
+        double sse = -1, avx = -1;
+        double heap = bench_heap(n, ops);
+        double linear = bench_linear(best, n, ops);
+
+#ifdef ARGMIN_HAVE_X86
+        if (__builtin_cpu_supports("sse4.1")) sse = bench_linear(argmin_select_sse41, n, ops);
+        if (__builtin_cpu_supports("avx2")) avx = bench_linear(argmin_select_avx2, n, ops);
+#endif
+        printf("%-8d %-11.1f ", n, scalar);
+        if (sse >= 0) printf("%-11.1f ", sse); else printf("%-11s ", "n/a");
+        if (avx >= 0) printf("%-11.1f ", avx); else printf("%-11s ", "n/a");
+        printf("%-11.1f %s\n", heap, heap < linear ? "heap" : best_name);
+
+        if (crossover < 0 && heap < linear) crossover = n;
+    }
+    printf("=================================================================\n");
+    printf("(ns per select-and-replace)\n\n");
+
+    if (crossover == MIN_READY) {
+        printf("Crossover: the heap was faster at every ready-set size measured.\n");
+    } else if (crossover > 0) {
+        printf("Crossover: the heap overtakes the %s scan at ~%d ready jobs.\n", best_name, crossover);
+    } else {
+        printf("Crossover: the %s scan stayed ahead up to %d ready jobs.\n", best_name, MAX_READY);
+    }
+    return 0;
+}
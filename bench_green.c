@@ -0,0 +1,149 @@
+#include <time.h>
+#include "green.h"
+#include "scheduler.h"
+
+#define SWITCH_ROUNDS 1000000
+#define SPAWN_BATCH 1000
+#define SPAWN_BATCHES 200
+#define WORK_PER_UNIT 20000        // spin iterations standing in for one time unit
+
+// ─────────────────────────────────────────────────────────
+// Green-thread runtime demo and microbenchmark
+//
+// 1. Runs the ten workload jobs as real tasks under each policy.  A task
+//    does burst_time units of work and yields after every unit.
+// 2. Switch latency: two RR tasks with quantum 1 ping-pong on every yield.
+// 3. Task throughput: batches of short tasks spawned, run and recycled.
+// ─────────────────────────────────────────────────────────
+
+typedef struct {
+    GreenRuntime *rt;
+    const Job *job;
+    long long *clock;              // units of work done by all tasks so far
+    long long first_run;
+    long long finished;
+} WorkloadTask;
+
+typedef struct {
+    GreenRuntime *rt;
+    long long rounds;
+} PingTask;
+
+static volatile unsigned long long spin_sink;
+
+static double now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static void workload_task(void *arg) {
+    WorkloadTask *w = arg;
+
+    w->first_run = *w->clock;
+    for (int unit = 0; unit < w->job->burst_time; unit++) {
+        for (int i = 0; i < WORK_PER_UNIT; i++) spin_sink += i;
+        (*w->clock)++;
+        green_yield(w->rt);
+    }
+    w->finished = *w->clock;
+}
+
+static void ping_task(void *arg) {
+    PingTask *p = arg;
+    for (long long i = 0; i < p->rounds; i++) green_yield(p->rt);
+}
+
+static void short_task(void *arg) {
+    GreenRuntime *rt = arg;
+    green_yield(rt);
+}
+
+static void run_workload(const Job jobs[], GreenPolicy policy, const char *name, int quantum) {
+    GreenRuntime rt;
+    WorkloadTask tasks[MAX_PROCESSES];
+    long long clock = 0, total_tat = 0, total_rt = 0;
+    int order[MAX_PROCESSES];
+
+    green_init(&rt, policy, quantum);
+    for (int i = 0; i < MAX_PROCESSES; i++) {
+        tasks[i].rt = &rt;
+        tasks[i].job = &jobs[i];
+        tasks[i].clock = &clock;
+        green_spawn(&rt, workload_task, &tasks[i], jobs[i].type, jobs[i].priority, jobs[i].burst_time);
+    }
+    green_run(&rt);
+
+    for (int i = 0; i < MAX_PROCESSES; i++) order[i] = i;
+    for (int i = 1; i < MAX_PROCESSES; i++) {
+        int k = order[i], j = i;
+        while (j > 0 && tasks[order[j - 1]].finished > tasks[k].finished) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = k;
+    }
+
+    printf("%-9s", name);
+    for (int i = 0; i < MAX_PROCESSES; i++) {
+        printf(" %s", jobs[order[i]].name);
+        total_tat += tasks[i].finished;
+        total_rt += tasks[i].first_run;
+    }
+    printf("\n          avg completion %.1f units, avg response %.1f units, %lld switches\n",
+           (double)total_tat / MAX_PROCESSES, (double)total_rt / MAX_PROCESSES, rt.switches);
+    green_destroy(&rt);
+}
+
+int main() {
+    Job jobs[MAX_PROCESSES];
+    GreenRuntime rt;
+    PingTask ping;
+    double start, elapsed;
+
+    printf("========================================\n");
+    printf("  Green-Thread Task Runtime\n");
+    printf("  (ucontext coroutines, one OS thread)\n");
+    printf("========================================\n\n");
+
+    initialize_processes(jobs);
+
+    printf("Completion Order (all tasks spawned at time 0):\n");
+    printf("=================================\n");
+    run_workload(jobs, GREEN_FCFS, "FCFS", 1);
+    run_workload(jobs, GREEN_SJF, "SJF", 1);
+    run_workload(jobs, GREEN_RR, "RR", TIME_QUANTUM);
+    run_workload(jobs, GREEN_PRIORITY, "Priority", 1);
+
+    // Switch latency
+    green_init(&rt, GREEN_RR, 1);
+    ping.rt = &rt;
+    ping.rounds = SWITCH_ROUNDS;
+    green_spawn(&rt, ping_task, &ping, "Ping", 1, 1);
+    green_spawn(&rt, ping_task, &ping, "Pong", 1, 1);
+    start = now_ns();
+    green_run(&rt);
+    elapsed = now_ns() - start;
+
+    printf("\n\nMicrobenchmark:\n");
+    printf("=================================\n");
+    printf("Context Switches           : %lld\n", rt.switches);
+    printf("Switch Latency             : %.1f ns\n", elapsed / rt.switches);
+    green_destroy(&rt);
+
+    // Task throughput
+    green_init(&rt, GREEN_FCFS, 1);
+    start = now_ns();
+    for (int b = 0; b < SPAWN_BATCHES; b++) {
+        for (int i = 0; i < SPAWN_BATCH; i++) green_spawn(&rt, short_task, &rt, "Web Request", 1, 1);
+        green_run(&rt);
+    }
+    elapsed = now_ns() - start;
+
+    printf("Tasks Completed            : %lld\n", rt.completed);
+    printf("Task Throughput            : %.0f tasks/second\n", rt.completed / (elapsed / 1e9));
+    printf("Time per Task              : %.1f ns (spawn + run + one yield + exit)\n",
+           elapsed / rt.completed);
+    green_destroy(&rt);
+    return 0;
+}
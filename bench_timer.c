@@ -0,0 +1,169 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "timing_wheel.h"
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <time.h>
+#else
+    #include <unistd.h>
+    #include <sys/time.h>
+#endif
+
+#define MIN_TIMERS 256
+#define MAX_TIMERS (1 << 20)
+#define OPS 4000000                // expire-and-rearm operations per measurement
+
+// ─────────────────────────────────────────────────────────
+// Event-queue benchmark: a fixed number of timers is pending, and every
+// operation expires the earliest one and re-arms it a random delay later,
+// as a simulator does for quantum expiries, I/O completions and swaps.
+// Short delays (1..64, tiny quanta) and long delays (1..2^16) are timed
+// separately; both queues must expire the timers in the same order.
+// ─────────────────────────────────────────────────────────
+
+typedef struct {
+    int *heap;
+    int *time;
+    int *seq;                      // arm order, so ties expire first-armed first like the wheel
+    int next_seq;
+    int n;
+} EventHeap;
+
+double get_time() {
+#ifdef _WIN32
+    return (double)clock() / CLOCKS_PER_SEC;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+#endif
+}
+
+static unsigned int rng_state = 12345;
+
+static int next_random(int bound) {
+    rng_state = rng_state * 1103515245u + 12345u;
+    return (int)((rng_state >> 8) % (unsigned int)bound);
+}
+
+static int event_less(const EventHeap *h, int a, int b) {
+    if (h->time[a] != h->time[b]) return h->time[a] < h->time[b];
+    return h->seq[a] < h->seq[b];
+}
+
+static void event_push(EventHeap *h, int id) {
+    int pos = h->n++;
+
+    h->seq[id] = h->next_seq++;
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (!event_less(h, id, h->heap[parent])) break;
+        h->heap[pos] = h->heap[parent];
+        pos = parent;
+    }
+    h->heap[pos] = id;
+}
+
+static int event_pop(EventHeap *h) {
+    int top = h->heap[0], last = h->heap[--h->n], pos = 0;
+
+    for (;;) {
+        int child = 2 * pos + 1;
+        if (child >= h->n) break;
+        if (child + 1 < h->n && event_less(h, h->heap[child + 1], h->heap[child])) child++;
+        if (!event_less(h, h->heap[child], last)) break;
+        h->heap[pos] = h->heap[child];
+        pos = child;
+    }
+    if (h->n > 0) h->heap[pos] = last;
+    return top;
+}
+
+// The clock ends near OPS * max_delay / (2 * timers), inside int for
+// every size measured
+static double bench_heap(int timers, int max_delay, unsigned long long *check) {
+    EventHeap h;
+    unsigned long long sum = 0;
+    double start;
+
+    rng_state = 12345;
+    h.heap = malloc(sizeof(int) * timers);
+    h.time = malloc(sizeof(int) * timers);
+    h.seq = malloc(sizeof(int) * timers);
+    h.next_seq = 0;
+    h.n = 0;
+    for (int id = 0; id < timers; id++) {
+        h.time[id] = 1 + next_random(max_delay);
+        event_push(&h, id);
+    }
+    start = get_time();
+    for (int op = 0; op < OPS; op++) {
+        int id = event_pop(&h);
+        int now = h.time[id];
+        sum = sum * 31 + (unsigned)id;
+        h.time[id] = now + 1 + next_random(max_delay);
+        event_push(&h, id);
+    }
+    double elapsed = get_time() - start;
+    free(h.heap);
+    free(h.time);
+    free(h.seq);
+    *check = sum;
+    return elapsed * 1e9 / OPS;
+}
+
+static double bench_wheel(int timers, int max_delay, unsigned long long *check) {
+    TimingWheel w;
+    unsigned long long sum = 0;
+    double start;
+
+    rng_state = 12345;
+    wheel_init(&w, timers, 0);
+    for (int id = 0; id < timers; id++) wheel_insert(&w, id, 1 + next_random(max_delay));
+    start = get_time();
+    for (int op = 0; op < OPS; op++) {
+        int id = wheel_pop(&w);
+        sum = sum * 31 + (unsigned)id;
+        wheel_insert(&w, id, w.now + 1 + next_random(max_delay));
+    }
+    double elapsed = get_time() - start;
+    wheel_free(&w);
+    *check = sum;
+    return elapsed * 1e9 / OPS;
+}
+
+int main() {
+    static const int delays[] = {64, 1 << 16};
+    int mismatches = 0;
+
+    printf("========================================\n");
+    printf("  Event Queue Benchmark\n");
+    printf("  Hierarchical Timing Wheel vs Binary Heap\n");
+    printf("========================================\n\n");
+
+    for (int d = 0; d < 2; d++) {
+        printf("Delays 1..%d:\n", delays[d]);
+        printf("Timers   Heap        Wheel       Speedup\n");
+        printf("=================================================\n");
+        for (int n = MIN_TIMERS; n <= MAX_TIMERS; n *= 4) {
+            unsigned long long heap_check, wheel_check;
+            double heap = bench_heap(n, delays[d], &heap_check);
+            double wheel = bench_wheel(n, delays[d], &wheel_check);
+
+            printf("%-8d %-11.1f %-11.1f %.2fx%s\n", n, heap, wheel, heap / wheel,
+                   heap_check == wheel_check ? "" : "  (ORDER MISMATCH)");
+            if (heap_check != wheel_check) mismatches++;
+        }
+        printf("=================================================\n");
+        printf("(ns per expire-and-rearm)\n\n");
+    }
+
+    if (mismatches) {
+        printf("The wheel expired timers in a different order than the heap.\n");
+        return 1;
+    }
+    printf("Both queues expired every timer in the same order.\n");
+    return 0;
+}
@@ -0,0 +1,583 @@
+#include <math.h>
+#include <pthread.h>
+#include "scheduler.h"
+
+#define NUM_TEMPLATES MAX_PROCESSES    // the built-in jobs, replayed as job types
+#define DEFAULT_NODES 1000
+#define DEFAULT_JOBS 200000
+#define DEFAULT_LOOKAHEAD 4        // dispatcher -> node latency, in time units
+#define TARGET_LOAD 0.85           // offered load per node
+#define WORKLOAD_SEED 42
+
+// ─────────────────────────────────────────────────────────
+// Cluster model
+//
+// Every node owns one CPU and one TOTAL_MEMORY pool and runs the same
+// FCFS + swapping discipline as the fcfs policy on the jobs placed on it.
+// Job types, SWAP_TIME and TOTAL_MEMORY come from scheduler.h.  A node
+// never overcommits memory: it runs one job at a time to completion, so
+// when the next job starts every resident job has finished, and swapping
+// them out frees the whole pool.  The only job that cannot get its memory
+// is one larger than a node, and the dispatcher rejects it the way the
+// engine's memory admission does.  A single
+// global dispatcher places each arriving job on a node.  Placement reaches
+// the node DISPATCH latency (the lookahead) later, so during the window
+// [T, T + lookahead) no node can receive work it has to act on: all nodes
+// simulate that window in parallel, then meet at a barrier while the
+// dispatcher places the next window's arrivals using the node states at
+// the window boundary.  The result is identical for any thread count.
+// ─────────────────────────────────────────────────────────
+
+typedef enum {
+    PLACE_LEAST_LOADED,
+    PLACE_MEMORY_FIT,
+    PLACE_POWER_OF_TWO
+} Placement;
+
+typedef struct {
+    int pid;
+    int tmpl;                      // index of its type in the built-in workload
+    int arrival_time;
+    int burst_time;
+    int memory_required;
+    int node;                      // -1 if rejected
+    int deliver_time;
+    int start_time;
+    int completion_time;
+    int is_swapped;
+} ClusterJob;
+
+typedef struct {
+    int *items;
+    int head;
+    int count;
+    int cap;
+} IntQueue;
+
+typedef struct {
+    int id;
+    int busy_until;
+    int available_memory;
+    long long queued_work;         // burst units placed but not yet started
+    IntQueue queue;                // placed jobs, FIFO
+    IntQueue resident;             // completed jobs still holding memory
+    long long busy_time;
+    int completed;
+    int swap_ops;
+} Node;
+
+typedef struct {
+    ClusterJob *jobs;
+    int n_jobs;
+    int rejected;                  // larger than a node's memory
+    Node *nodes;
+    int n_nodes;
+    int n_threads;
+    int lookahead;
+    Placement placement;
+    pthread_barrier_t barrier;
+
+    // Dispatcher's min-heap of nodes keyed by (load, id), rebuilt per window
+    int *heap;
+    long long *load;
+
+    // Memory-fit: nodes sorted by free memory, most first, and a min-load
+    // segment tree over that order, both rebuilt per window
+    int *by_memory;
+    int *leaf_of;                  // node -> its position in by_memory
+    int *fit_tree;
+    int *memory_count;             // counting-sort buckets, TOTAL_MEMORY + 1
+
+    // Shared between phases, written only by thread 0 in the serial phase
+    int next_job;
+    int window_end;
+    int done;
+    int windows;
+    unsigned long long rng;
+} Cluster;
+
+typedef struct {
+    Cluster *c;
+    int tid;
+} Worker;
+
+static Job templates[NUM_TEMPLATES];
+
+static const char *placement_names[] = {"least-loaded", "memory-fit", "power-of-two"};
+
+static int online_cpus(void) {
+#ifdef _WIN32
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return (int)si.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+#endif
+}
+
+// xorshift64*: deterministic across platforms, unlike rand()
+static unsigned long long next_random(unsigned long long *state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+static double next_uniform(unsigned long long *state) {
+    return (next_random(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static void queue_push(IntQueue *q, int value) {
+    if (q->count == q->cap) {
+        int new_cap = q->cap ? q->cap * 2 : 16;
+        int *items = malloc(sizeof(int) * new_cap);
+        for (int i = 0; i < q->count; i++) {
+            items[i] = q->items[(q->head + i) % q->cap];
+        }
+        free(q->items);
+        q->items = items;
+        q->head = 0;
+        q->cap = new_cap;
+    }
+    q->items[(q->head + q->count) % q->cap] = value;
+    q->count++;
+}
+
+static int queue_front(const IntQueue *q) {
+    return q->items[q->head];
+}
+
+static int queue_pop(IntQueue *q) {
+    int value = q->items[q->head];
+    q->head = (q->head + 1) % q->cap;
+    q->count--;
+    return value;
+}
+
+void generate_workload(ClusterJob jobs[], int n, int n_nodes, unsigned long long seed) {
+    unsigned long long rng = seed;
+    double mean_service = 0;
+    double t = 0;
+
+    for (int i = 0; i < NUM_TEMPLATES; i++) {
+        mean_service += templates[i].burst_time + 2 * SWAP_TIME;   // swap in + out
+    }
+    mean_service /= NUM_TEMPLATES;
+
+    // Poisson arrivals sized so every node sees roughly TARGET_LOAD
+    double mean_gap = mean_service / (n_nodes * TARGET_LOAD);
+
+    for (int i = 0; i < n; i++) {
+        int k = (int)(next_random(&rng) % NUM_TEMPLATES);
+        double u = next_uniform(&rng);
+
+        t += -mean_gap * log(1.0 - u);
+        jobs[i].pid = i + 1;
+        jobs[i].tmpl = k;
+        jobs[i].arrival_time = (int)t;
+        jobs[i].burst_time = templates[k].burst_time;
+        jobs[i].memory_required = templates[k].memory_required;
+        jobs[i].node = -1;
+        jobs[i].deliver_time = 0;
+        jobs[i].start_time = 0;
+        jobs[i].completion_time = 0;
+        jobs[i].is_swapped = 0;
+    }
+}
+
+static long long node_load(const Node *nd, int now) {
+    long long backlog = nd->busy_until > now ? nd->busy_until - now : 0;
+    return backlog + nd->queued_work;
+}
+
+static int heap_less(const Cluster *c, int a, int b) {
+    return c->load[a] < c->load[b] || (c->load[a] == c->load[b] && a < b);
+}
+
+static void heap_sift_down(Cluster *c, int n, int pos) {
+    int *h = c->heap;
+    for (;;) {
+        int l = 2 * pos + 1, r = l + 1, m = pos, tmp;
+        if (l < n && heap_less(c, h[l], h[m])) m = l;
+        if (r < n && heap_less(c, h[r], h[m])) m = r;
+        if (m == pos) return;
+        tmp = h[pos]; h[pos] = h[m]; h[m] = tmp;
+        pos = m;
+    }
+}
+
+// Node loads only move during the parallel phase or through our own
+// placements, so one O(nodes) rebuild per window keeps every placement
+// at O(log nodes) instead of a scan over the whole cluster.
+static void rebuild_load_heap(Cluster *c, int now) {
+    for (int i = 0; i < c->n_nodes; i++) {
+        c->heap[i] = i;
+        c->load[i] = node_load(&c->nodes[i], now);
+    }
+    for (int i = c->n_nodes / 2 - 1; i >= 0; i--) {
+        heap_sift_down(c, c->n_nodes, i);
+    }
+}
+
+static int less_loaded(const Cluster *c, int a, int b) {
+    if (a < 0) return b;
+    if (b < 0) return a;
+    return heap_less(c, b, a) ? b : a;
+}
+
+static void fit_tree_update(Cluster *c, int leaf) {
+    int n = c->n_nodes;
+
+    for (int p = (n + leaf) / 2; p >= 1; p /= 2) {
+        c->fit_tree[p] = less_loaded(c, c->fit_tree[2 * p], c->fit_tree[2 * p + 1]);
+    }
+}
+
+// Free memory only changes in the parallel phase, so the memory order
+// holds for the whole window and placements only update loads
+static void rebuild_fit_tree(Cluster *c, int now) {
+    int n = c->n_nodes;
+
+    memset(c->memory_count, 0, sizeof(int) * (TOTAL_MEMORY + 1));
+    for (int i = 0; i < n; i++) {
+        c->load[i] = node_load(&c->nodes[i], now);
+        c->memory_count[c->nodes[i].available_memory]++;
+    }
+    for (int m = TOTAL_MEMORY, start = 0; m >= 0; m--) {
+        int count = c->memory_count[m];
+        c->memory_count[m] = start;
+        start += count;
+    }
+    for (int i = 0; i < n; i++) {
+        int leaf = c->memory_count[c->nodes[i].available_memory]++;
+        c->by_memory[leaf] = i;
+        c->leaf_of[i] = leaf;
+        c->fit_tree[n + leaf] = i;
+    }
+    for (int p = n - 1; p >= 1; p--) {
+        c->fit_tree[p] = less_loaded(c, c->fit_tree[2 * p], c->fit_tree[2 * p + 1]);
+    }
+}
+
+// Memory-fit: the least-loaded node that can take the job without
+// swapping, or the least-loaded node if none can.  The nodes that fit are
+// a prefix of the memory order, so this is one prefix-minimum query.
+static int find_memory_fit(const Cluster *c, int memory) {
+    int lo = 0, hi = c->n_nodes, best = -1;
+
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (c->nodes[c->by_memory[mid]].available_memory >= memory) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo == 0) lo = c->n_nodes;
+    for (int l = c->n_nodes, r = c->n_nodes + lo; l < r; l /= 2, r /= 2) {
+        if (l & 1) best = less_loaded(c, best, c->fit_tree[l++]);
+        if (r & 1) best = less_loaded(c, best, c->fit_tree[--r]);
+    }
+    return best;
+}
+
+static int place_job(Cluster *c, const ClusterJob *job, int now) {
+    int best;
+
+    if (c->placement == PLACE_POWER_OF_TWO) {
+        int a = (int)(next_random(&c->rng) % c->n_nodes);
+        int b = (int)(next_random(&c->rng) % c->n_nodes);
+        return node_load(&c->nodes[a], now) <= node_load(&c->nodes[b], now) ? a : b;
+    }
+    if (c->placement == PLACE_MEMORY_FIT) {
+        best = find_memory_fit(c, job->memory_required);
+        c->load[best] += job->burst_time;
+        fit_tree_update(c, c->leaf_of[best]);
+        return best;
+    }
+
+    best = c->heap[0];
+    c->load[best] += job->burst_time;
+    heap_sift_down(c, c->n_nodes, 0);
+    return best;
+}
+
+// Serial phase: place every arrival of the next window and decide whether
+// the simulation is finished.  Only thread 0 runs this.
+static void dispatch_window(Cluster *c) {
+    int window_start = c->window_end;
+    int idle = 1;
+
+    for (int i = 0; i < c->n_nodes; i++) {
+        if (c->nodes[i].queue.count > 0) {
+            idle = 0;
+            break;
+        }
+    }
+
+    if (c->next_job >= c->n_jobs) {
+        c->done = idle;
+        c->window_end = window_start + c->lookahead;
+        c->windows++;
+        return;
+    }
+
+    // Nothing in flight: jump straight to the next arrival
+    if (idle && c->jobs[c->next_job].arrival_time > window_start) {
+        window_start = c->jobs[c->next_job].arrival_time;
+    }
+
+    c->window_end = window_start + c->lookahead;
+    if (c->placement == PLACE_LEAST_LOADED) rebuild_load_heap(c, window_start);
+    else if (c->placement == PLACE_MEMORY_FIT) rebuild_fit_tree(c, window_start);
+
+    while (c->next_job < c->n_jobs && c->jobs[c->next_job].arrival_time < c->window_end) {
+        ClusterJob *job = &c->jobs[c->next_job];
+        int target;
+        Node *nd;
+
+        // No node could ever hold it
+        if (job->memory_required > TOTAL_MEMORY) {
+            c->rejected++;
+            c->next_job++;
+            continue;
+        }
+        target = place_job(c, job, window_start);
+        nd = &c->nodes[target];
+        job->node = target;
+        job->deliver_time = job->arrival_time + c->lookahead;
+        queue_push(&nd->queue, c->next_job);
+        nd->queued_work += job->burst_time;
+        c->next_job++;
+    }
+    c->windows++;
+}
+
+// Parallel phase: run one node's FCFS + swapping loop up to window_end.
+// A job may only *start* inside the window; once started it is
+// non-preemptive, so its completion can safely lie beyond the window.
+static void simulate_node(Node *nd, ClusterJob jobs[], int window_end) {
+    while (nd->queue.count > 0) {
+        ClusterJob *job = &jobs[queue_front(&nd->queue)];
+        int t = nd->busy_until > job->deliver_time ? nd->busy_until : job->deliver_time;
+
+        if (t >= window_end) break;
+        queue_pop(&nd->queue);
+        nd->queued_work -= job->burst_time;
+
+        // Swap out the oldest completed residents until the job fits.
+        // Every resident has finished and the job fits an empty node, so
+        // this always makes room.
+        while (job->memory_required > nd->available_memory) {
+            ClusterJob *victim = &jobs[queue_pop(&nd->resident)];
+            victim->is_swapped = 1;
+            nd->available_memory += victim->memory_required;
+            t += SWAP_TIME;
+            nd->swap_ops++;
+        }
+
+        t += SWAP_TIME;
+        nd->swap_ops++;
+        nd->available_memory -= job->memory_required;
+
+        job->start_time = t;
+        t += job->burst_time;
+        job->completion_time = t;
+
+        queue_push(&nd->resident, (int)(job - jobs));
+        nd->busy_until = t;
+        nd->busy_time += job->burst_time;
+        nd->completed++;
+    }
+}
+
+static void *worker_main(void *arg) {
+    Worker *w = arg;
+    Cluster *c = w->c;
+    int first = (int)((long long)c->n_nodes * w->tid / c->n_threads);
+    int last = (int)((long long)c->n_nodes * (w->tid + 1) / c->n_threads);
+
+    for (;;) {
+        if (w->tid == 0) dispatch_window(c);
+        pthread_barrier_wait(&c->barrier);
+        if (c->done) break;
+
+        for (int i = first; i < last; i++) {
+            simulate_node(&c->nodes[i], c->jobs, c->window_end);
+        }
+        pthread_barrier_wait(&c->barrier);
+    }
+    return NULL;
+}
+
+void simulate_cluster(Cluster *c) {
+    pthread_t *threads = malloc(sizeof(pthread_t) * c->n_threads);
+    Worker *workers = malloc(sizeof(Worker) * c->n_threads);
+
+    pthread_barrier_init(&c->barrier, NULL, c->n_threads);
+    c->next_job = 0;
+    c->window_end = 0;
+    c->done = 0;
+    c->windows = 0;
+
+    for (int t = 0; t < c->n_threads; t++) {
+        workers[t].c = c;
+        workers[t].tid = t;
+        if (t > 0) pthread_create(&threads[t], NULL, worker_main, &workers[t]);
+    }
+    worker_main(&workers[0]);
+    for (int t = 1; t < c->n_threads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    pthread_barrier_destroy(&c->barrier);
+    free(workers);
+    free(threads);
+}
+
+void print_cluster_metrics(const Cluster *c, double exec_time) {
+    long long total_wt = 0, total_tat = 0, total_rt = 0, total_burst = 0;
+    long long type_wt[NUM_TEMPLATES] = {0}, type_rt[NUM_TEMPLATES] = {0};
+    int type_count[NUM_TEMPLATES] = {0};
+    int makespan = 0, served = c->n_jobs - c->rejected;
+    int swap_ops = 0;
+    int busiest = 0, idlest = 0;
+    double mean_busy, var_busy = 0;
+
+    for (int i = 0; i < c->n_jobs; i++) {
+        const ClusterJob *job = &c->jobs[i];
+        if (job->node < 0) continue;
+        int tat = job->completion_time - job->arrival_time;
+        int wt = tat - job->burst_time;
+        int rt = job->start_time - job->arrival_time;
+
+        total_tat += tat;
+        total_wt += wt;
+        total_rt += rt;
+        total_burst += job->burst_time;
+        type_wt[job->tmpl] += wt;
+        type_rt[job->tmpl] += rt;
+        type_count[job->tmpl]++;
+        if (job->completion_time > makespan) makespan = job->completion_time;
+    }
+
+    for (int i = 0; i < c->n_nodes; i++) {
+        const Node *nd = &c->nodes[i];
+        swap_ops += nd->swap_ops;
+        if (nd->busy_time > c->nodes[busiest].busy_time) busiest = i;
+        if (nd->busy_time < c->nodes[idlest].busy_time) idlest = i;
+    }
+    mean_busy = (double)total_burst / c->n_nodes;
+    for (int i = 0; i < c->n_nodes; i++) {
+        double d = c->nodes[i].busy_time - mean_busy;
+        var_busy += d * d;
+    }
+    var_busy /= c->n_nodes;
+
+    printf("\n\nCluster Performance Metrics:\n");
+    printf("=================================\n");
+    printf("Placement Policy           : %s\n", placement_names[c->placement]);
+    printf("Nodes / Threads            : %d / %d\n", c->n_nodes, c->n_threads);
+    printf("Jobs Completed             : %d\n", served);
+    printf("Rejected (too large)       : %d\n", c->rejected);
+    printf("Average Waiting Time       : %.2f units\n", served ? (double)total_wt / served : 0.0);
+    printf("Average Turnaround Time    : %.2f units\n", served ? (double)total_tat / served : 0.0);
+    printf("Average Response Time      : %.2f units\n", served ? (double)total_rt / served : 0.0);
+    printf("Makespan                   : %d units\n", makespan);
+    printf("Throughput                 : %.4f processes/unit\n",
+           makespan ? (double)served / makespan : 0.0);
+    printf("Cluster CPU Utilization    : %.2f%%\n",
+           makespan ? (double)total_burst / ((double)makespan * c->n_nodes) * 100 : 0.0);
+    printf("Node Busy Time (min/max)   : %lld / %lld units\n",
+           c->nodes[idlest].busy_time, c->nodes[busiest].busy_time);
+    printf("Node Load Imbalance (CV)   : %.4f\n",
+           mean_busy > 0 ? sqrt(var_busy) / mean_busy : 0.0);
+    printf("Total Swap Operations      : %d\n", swap_ops);
+    printf("Synchronisation Windows    : %d (lookahead %d units)\n", c->windows, c->lookahead);
+    printf("Program Execution Time     : %.6f seconds\n", exec_time);
+
+    printf("\n\nPer-Type Latency:\n");
+    printf("========================================================================\n");
+    printf("Type                            Jobs      Avg WT     Avg RT\n");
+    printf("========================================================================\n");
+    for (int k = 0; k < NUM_TEMPLATES; k++) {
+        if (type_count[k] == 0) continue;
+        printf("%-30s  %-8d  %-9.2f  %-9.2f\n", templates[k].type, type_count[k],
+               (double)type_wt[k] / type_count[k], (double)type_rt[k] / type_count[k]);
+    }
+    printf("========================================================================\n");
+}
+
+static int parse_placement(const char *s) {
+    for (int i = 0; i < 3; i++) {
+        if (strcmp(s, placement_names[i]) == 0) return i;
+    }
+    return -1;
+}
+
+int main(int argc, char *argv[]) {
+    Cluster c;
+    double start_time, end_time;
+    int placement = PLACE_LEAST_LOADED;
+
+    memset(&c, 0, sizeof(c));
+    c.n_nodes = argc > 1 ? atoi(argv[1]) : DEFAULT_NODES;
+    c.n_jobs = argc > 2 ? atoi(argv[2]) : DEFAULT_JOBS;
+    if (argc > 3 && (placement = parse_placement(argv[3])) < 0) {
+        fprintf(stderr, "Unknown placement '%s' (least-loaded, memory-fit, power-of-two)\n", argv[3]);
+        return 1;
+    }
+    c.n_threads = argc > 4 ? atoi(argv[4]) : online_cpus();
+    c.lookahead = argc > 5 ? atoi(argv[5]) : DEFAULT_LOOKAHEAD;
+    c.placement = placement;
+    c.rng = WORKLOAD_SEED;
+
+    if (c.n_nodes < 1 || c.n_jobs < 1 || c.n_threads < 1 || c.lookahead < 1) {
+        fprintf(stderr, "Usage: %s [nodes] [jobs] [placement] [threads] [lookahead]\n", argv[0]);
+        return 1;
+    }
+    if (c.n_threads > c.n_nodes) c.n_threads = c.n_nodes;
+
+    printf("========================================\n");
+    printf("  Cluster Scheduling Simulation\n");
+    printf("  (Per-node FCFS with Swapping)\n");
+    printf("  Parallel Conservative Discrete-Event\n");
+    printf("========================================\n\n");
+
+    c.jobs = malloc(sizeof(ClusterJob) * c.n_jobs);
+    c.nodes = calloc(c.n_nodes, sizeof(Node));
+    c.heap = malloc(sizeof(int) * c.n_nodes);
+    c.load = malloc(sizeof(long long) * c.n_nodes);
+    c.by_memory = malloc(sizeof(int) * c.n_nodes);
+    c.leaf_of = malloc(sizeof(int) * c.n_nodes);
+    c.fit_tree = malloc(sizeof(int) * 2 * c.n_nodes);
+    c.memory_count = malloc(sizeof(int) * (TOTAL_MEMORY + 1));
+    for (int i = 0; i < c.n_nodes; i++) {
+        c.nodes[i].id = i;
+        c.nodes[i].available_memory = TOTAL_MEMORY;
+    }
+    initialize_processes(templates);
+    generate_workload(c.jobs, c.n_jobs, c.n_nodes, WORKLOAD_SEED);
+
+    printf("Generated %d jobs for %d nodes (%d MB each)\n", c.n_jobs, c.n_nodes, TOTAL_MEMORY);
+    printf("Placement: %s, threads: %d, lookahead: %d units\n",
+           placement_names[c.placement], c.n_threads, c.lookahead);
+
+    start_time = get_time();
+    simulate_cluster(&c);
+    end_time = get_time();
+
+    print_cluster_metrics(&c, end_time - start_time);
+
+    for (int i = 0; i < c.n_nodes; i++) {
+        free(c.nodes[i].queue.items);
+        free(c.nodes[i].resident.items);
+    }
+    free(c.memory_count);
+    free(c.fit_tree);
+    free(c.leaf_of);
+    free(c.by_memory);
+    free(c.load);
+    free(c.heap);
+    free(c.nodes);
+    free(c.jobs);
+    return 0;
+}
@@ -0,0 +1,206 @@
+#ifndef COMPARE_H
+#define COMPARE_H
+
+#include "engine.h"
+
+#define COMPARE_POLICIES "fcfs,sjf,rr,priority"   // default for compare mode
+
+// ─────────────────────────────────────────────────────────
+// Compare mode
+//
+// Runs several policies over one workload at the same time.  The jobs are
+// copied once into pages of their own, which are then made read-only, so
+// every policy reads the same trace and a write to it faults instead of
+// skewing the other runs.  Each policy runs on its own thread with only
+// its private overlay: a JobState per job plus its SchedRun queues.
+// Comparing k policies then takes about as long as the slowest one, not
+// the sum of all k.  The results are printed as one table with a column
+// per policy.
+// ─────────────────────────────────────────────────────────
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <time.h>
+    #include <sys/mman.h>
+#endif
+
+typedef struct {
+    const Scheduler *sched;
+    SchedRun run;
+    JobState *state;
+    double seconds;                // CPU time its thread spent on the run
+} CompareRun;
+
+// Copy of jobs[] in read-only pages; NULL if the pages cannot be had
+static inline const Job *share_jobs(const Job jobs[], int n, size_t *bytes) {
+    size_t size = sizeof(Job) * (size_t)(n > 0 ? n : 1);
+    Job *copy;
+
+#ifdef _WIN32
+    DWORD old;
+
+    copy = VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (!copy) return NULL;
+    memcpy(copy, jobs, sizeof(Job) * n);
+    if (!VirtualProtect(copy, size, PAGE_READONLY, &old)) {
+        VirtualFree(copy, 0, MEM_RELEASE);
+        return NULL;
+    }
+#else
+    copy = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (copy == MAP_FAILED) return NULL;
+    memcpy(copy, jobs, sizeof(Job) * n);
+    if (mprotect(copy, size, PROT_READ) != 0) {
+        munmap(copy, size);
+        return NULL;
+    }
+#endif
+    *bytes = size;
+    return copy;
+}
+
+static inline void unshare_jobs(const Job *jobs, size_t bytes) {
+#ifdef _WIN32
+    (void)bytes;
+    VirtualFree((void *)jobs, 0, MEM_RELEASE);
+#else
+    munmap((void *)jobs, bytes);
+#endif
+}
+
+// CPU time of the calling thread, which the other runs sharing its core
+// do not inflate the way they would a wall clock
+static inline double thread_cpu_time(void) {
+#ifdef _WIN32
+    FILETIME created, exited, kernel, user;
+    ULARGE_INTEGER t;
+
+    if (!GetThreadTimes(GetCurrentThread(), &created, &exited, &kernel, &user)) return get_time();
+    t.LowPart = user.dwLowDateTime;
+    t.HighPart = user.dwHighDateTime;
+    return t.QuadPart / 1e7;
+#else
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) return get_time();
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+#endif
+}
+
+#ifdef _WIN32
+static DWORD WINAPI compare_thread(LPVOID arg) {
+#else
+static void *compare_thread(void *arg) {
+#endif
+    CompareRun *c = arg;
+    double start = thread_cpu_time();
+
+    c->sched->run(&c->run);
+    c->seconds = thread_cpu_time() - start;
+    return 0;
+}
+
+// Starts one thread per run and waits for all of them.  A run whose
+// thread cannot be created is run on the calling thread instead.
+static inline double run_concurrently(CompareRun runs[], int k) {
+#ifdef _WIN32
+    HANDLE threads[NUM_SCHEDULERS];
+#else
+    pthread_t threads[NUM_SCHEDULERS];
+#endif
+    int started[NUM_SCHEDULERS];
+    double start;
+
+    start = get_time();
+    for (int i = 0; i < k; i++) {
+#ifdef _WIN32
+        threads[i] = CreateThread(NULL, 0, compare_thread, &runs[i], 0, NULL);
+        started[i] = threads[i] != NULL;
+#else
+        started[i] = pthread_create(&threads[i], NULL, compare_thread, &runs[i]) == 0;
+#endif
+        if (!started[i]) compare_thread(&runs[i]);
+    }
+    for (int i = 0; i < k; i++) {
+        if (!started[i]) continue;
+#ifdef _WIN32
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+#else
+        pthread_join(threads[i], NULL);
+#endif
+    }
+    return get_time() - start;
+}
+
+// Missed or rejected jobs as a percentage of the jobs with a deadline
+static inline double deadline_miss_ratio(const Job jobs[], const JobState state[], int n) {
+    int with_deadline = 0, missed = 0;
+
+    for (int i = 0; i < n; i++) {
+        if (jobs[i].deadline == NO_DEADLINE) continue;
+        with_deadline++;
+        if (state[i].rejected || state[i].completion_time > jobs[i].deadline) missed++;
+    }
+    return with_deadline ? (double)missed / with_deadline * 100 : 0.0;
+}
+
+// One table cell: num / den * scale, or "-" for a run that served no jobs
+static inline void print_ratio_cell(double num, long long den, double scale, int decimals) {
+    if (den == 0) printf("%12s", "-");
+    else printf("%12.*f", decimals, num / den * scale);
+}
+
+static inline void print_comparison(const Job jobs[], const CompareRun runs[], int k, double wall) {
+    RunSummary sum[NUM_SCHEDULERS];
+    double total = 0;
+    int n = runs[0].run.n;
+
+    for (int i = 0; i < k; i++) {
+        summarize_run(jobs, runs[i].state, n, &sum[i]);
+        total += runs[i].seconds;
+    }
+
+    printf("\n\nPolicy Comparison:\n");
+    printf("========================================");
+    for (int i = 0; i < k; i++) printf("============");
+    printf("\n%-28s", "");
+    for (int i = 0; i < k; i++) printf("%12s", runs[i].sched->policy->name);
+    printf("\n----------------------------------------");
+    for (int i = 0; i < k; i++) printf("------------");
+    printf("\n%-28s", "Average Waiting Time");
+    for (int i = 0; i < k; i++) print_ratio_cell(sum[i].total_wt, sum[i].served, 1, 2);
+    printf("\n%-28s", "Average Turnaround Time");
+    for (int i = 0; i < k; i++) print_ratio_cell(sum[i].total_tat, sum[i].served, 1, 2);
+    printf("\n%-28s", "Average Response Time");
+    for (int i = 0; i < k; i++) print_ratio_cell(sum[i].total_rt, sum[i].served, 1, 2);
+    printf("\n%-28s", "Throughput (jobs/unit)");
+    for (int i = 0; i < k; i++) print_ratio_cell(sum[i].served, sum[i].makespan, 1, 4);
+    printf("\n%-28s", "CPU Utilization (%)");
+    for (int i = 0; i < k; i++) print_ratio_cell(sum[i].total_burst, sum[i].makespan, 100, 2);
+    printf("\n%-28s", "Total Execution Time");
+    for (int i = 0; i < k; i++) printf("%12d", sum[i].makespan);
+    printf("\n%-28s", "Context Switches");
+    for (int i = 0; i < k; i++) printf("%12d", runs[i].run.stats.context_switches);
+    printf("\n%-28s", "Preemptions");
+    for (int i = 0; i < k; i++) printf("%12d", runs[i].run.stats.preemptions);
+    printf("\n%-28s", "Swap Operations");
+    for (int i = 0; i < k; i++) printf("%12d", runs[i].run.stats.swap_operations);
+    printf("\n%-28s", "Memory Waits");
+    for (int i = 0; i < k; i++) printf("%12d", runs[i].run.stats.memory_waits);
+    printf("\n%-28s", "Rejected by Admission");
+    for (int i = 0; i < k; i++) printf("%12d", runs[i].run.stats.rejected);
+    printf("\n%-28s", "Deadline Miss Ratio (%)");
+    for (int i = 0; i < k; i++) printf("%12.2f", deadline_miss_ratio(jobs, runs[i].state, n));
+    printf("\n%-28s", "CPU Time (ms)");
+    for (int i = 0; i < k; i++) printf("%12.2f", runs[i].seconds * 1000);
+    printf("\n========================================");
+    for (int i = 0; i < k; i++) printf("============");
+    printf("\nWall Time                  : %.6f seconds for %d policies\n", wall, k);
+    printf("CPU Time Added Up          : %.6f seconds, %.2fx the wall time\n", total,
+           wall > 0 ? total / wall : 0.0);
+}
+
+#endif
@@ -0,0 +1,1891 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include <limits.h>
+#include "scheduler.h"
+#include "timing_wheel.h"
+#include "profile.h"
+
+// ─────────────────────────────────────────────────────────
+// Scheduling engine
+//
+// One event loop (arrivals, swapping, dispatch, preemption, completion)
+// shared by every policy.  A Policy is a constant table of small hooks;
+// run_policy() is force-inlined into one calculate_<policy>() per policy,
+// so the compiler sees a constant table and turns every hook call in the
+// hot loop into a direct, usually inlined, call.  The only runtime
+// dispatch is picking which calculate_<policy>() to call.
+// ─────────────────────────────────────────────────────────
+
+#if defined(__GNUC__)
+    #define SCHED_INLINE inline __attribute__((always_inline))
+#else
+    #define SCHED_INLINE inline
+#endif
+
+#define SCHED_LOG(r, ...)                                                       \
+    do {                                                                        \
+        if ((r)->verbose) {                                                     \
+            PROF_ENTER(r, PROF_LOG);                                            \
+            printf(__VA_ARGS__);                                                \
+            PROF_LEAVE(r);                                                      \
+        }                                                                       \
+    } while (0)
+
+// Order in which completed jobs are considered for swap-out
+typedef enum {
+    VICTIMS_BY_INDEX,
+    VICTIMS_BY_ARRIVAL
+} VictimOrder;
+
+// What EDF does with a job that fails the admission test
+typedef enum {
+    ADMIT_NONE,                    // no test, every job is admitted
+    ADMIT_REJECT,                  // refuse the job; it never runs
+    ADMIT_DEFER                    // run it after every guaranteed job
+} AdmissionMode;
+
+#define EDF_EMPTY (LLONG_MIN / 4)
+#define NO_WAIT LLONG_MAX              // memory wait tree: no job under the node
+
+// Which waiting jobs get memory when some is freed
+typedef enum {
+    PACK_FIFO,                     // in wait order; the head blocks the rest
+    PACK_FIRST_FIT,                // in wait order, skipping jobs that do not fit
+    PACK_BEST_FIT                  // largest job that fits first
+} MemoryPacking;
+
+// How the fair-share policy orders jobs inside one group
+typedef enum {
+    INNER_FCFS,
+    INNER_SJF,
+    INNER_RR,
+    INNER_PRIORITY,
+    INNER_EDF
+} InnerPolicy;
+
+#define FAIR_SCALE (1LL << 20)         // virtual-time units per unit of CPU at weight 1
+#define STRIDE_SCALE (1LL << 20)       // pass units per unit of CPU at one ticket
+
+// One job-type group (tenant)
+typedef struct {
+    char name[50];
+    int weight;
+    int runnable;                  // jobs ready or running
+    long long used;                // CPU time received
+    double entitled;               // CPU time its weight earned while runnable
+    long long vtime;               // fair share: CPU time received / weight
+    int *heap;                     // fair share: the group's ready jobs
+    int n_ready;
+    int cap;
+} FairGroup;
+
+// How the predicted-SJF policy estimates a job's next CPU burst
+typedef enum {
+    PREDICT_EMA,                   // exponential average of past bursts
+    PREDICT_PERCENTILE             // streaming percentile of past bursts (P²)
+} PredictMode;
+
+// Which jobs share an estimator
+typedef enum {
+    PREDICT_BY_TYPE,
+    PREDICT_BY_NAME                // recurring jobs in a trace
+} PredictKey;
+
+// Where lottery and stride tickets come from
+typedef enum {
+    TICKETS_NONE,                  // no tickets: no share accounting
+    TICKETS_BY_PRIORITY,
+    TICKETS_BY_TYPE                // the job's group weight
+} TicketSource;
+
+// Streaming estimates over a series of values (one key's bursts, or the
+// latencies of a streamed run).  Both are kept up to date in O(1) per
+// value: the exponential average, and the P² markers (Jain and Chlamtac)
+// whose middle height tracks the chosen percentile.
+typedef struct {
+    long long samples;
+    double ema;
+    double height[5];              // P² marker heights; the first five samples, sorted
+    int pos[5];                    // P² marker positions
+    double want[5];                // P² desired marker positions
+} Estimator;
+
+#define STREAM_INITIAL_SLOTS 1024     // job slots a streamed run starts with
+
+// What a streamed run keeps of the jobs it has retired
+typedef struct {
+    long long served;
+    long long rejected;
+    long long total_wt;
+    long long total_tat;
+    long long total_rt;
+    long long total_burst;
+    long long total_swap_time;
+    long long swapped;             // jobs swapped out after completing
+    int makespan;
+    Estimator tat[3];              // p50, p95, p99
+    Estimator rt[3];
+    long long with_deadline;
+    long long missed;
+    long long total_tardiness;
+    int max_tardiness;
+    Estimator tardiness[3];
+} StreamTotals;
+
+static const int STREAM_PERCENTILES[3] = {50, 95, 99};
+
+typedef struct SchedRun SchedRun;
+
+typedef struct {
+    const char *name;              // command-line name
+    const char *title;             // banner heading
+    const char *mode;              // banner / log subtitle
+    const char *tag;               // appended to dispatch log lines
+    const char *analysis;          // closing scenario analysis
+    int preemptive;                // slices are bounded by the quantum
+    VictimOrder victims;
+    void (*enqueue)(SchedRun *r, int idx);
+    int (*select)(SchedRun *r);
+    int (*slice)(SchedRun *r, int idx);
+    // Optional: after an unfinished job is re-enqueued, whether another job
+    // takes the CPU (NULL: always, the job counts as preempted)
+    int (*preempted)(SchedRun *r, int idx);
+    // Optional: allocates the per-job arrays only this policy uses, once
+    // the run is configured and before the first arrival
+    void (*init)(SchedRun *r);
+} Policy;
+
+struct SchedRun {
+    const Job *jobs;
+    JobState *state;
+    int n;
+    int total_memory;
+    int available_memory;
+    int current_time;
+    int completed;
+    int quantum;
+    int verbose;
+    int switch_cost;               // CPU time lost per context switch
+    int cache_penalty;             // extra time when a job resumes on a cold cache
+    int last_job;                  // last job on the CPU, -1 before the first
+    RunStats stats;
+
+    int round_left;                // adaptive RR: dispatches left in this round
+    int round_quantum;
+    int *scratch;
+
+    int *arrival_order;            // job indices sorted by (arrival_time, index)
+    int *arrival_rank;             // position of each job in arrival_order
+    int next_arrival;
+
+    int *victims;                  // completed, swapped-in jobs: heap in swap-out order
+    int n_victims;
+    const int *victim_key;         // NULL: by index
+    int victim_memory;             // held by completed jobs, reclaimable by swap-out
+
+    int packing;                   // MemoryPacking
+    // Jobs waiting for memory: a FIFO per memory size, and a segment tree
+    // over the sizes holding the wait number of each size's first job
+    int *wait_head;                // first waiting job of each size, -1 if none
+    int *wait_tail;
+    int *wait_next;                // next waiting job of the same size
+    long long *wait_order;         // wait number of each waiting job
+    long long *wait_tree;          // root at 1; node 0 stays NO_WAIT
+    int wait_leaves;               // power of two > total_memory
+    long long next_wait;
+    int n_waiting;
+    int reserved_memory;           // promised to released jobs not swapped in yet
+
+    int n_devices;                 // I/O devices, each serving one request at a time
+    int device_free[MAX_IO_DEVICES];
+    TimingWheel io_wheel;          // blocked jobs by I/O completion time
+
+    const Dag *dag;                // job dependencies, NULL if none
+    int *pending;                  // unfinished predecessors of each job
+    int *cp_rank;                  // upward rank: own work + longest chain after it (DAG or cpath)
+    int *cp_key;                   // ready-heap key for the critical-path policy
+
+    FairGroup *groups;             // job-type groups
+    int n_groups;
+    int *group_of;
+    int inner;                     // fair share: InnerPolicy
+    int *fair_seq;                 // fair share: FIFO position within the group
+    int next_seq;
+    long long fair_clock;          // fair share: vtime of the group last dispatched
+
+    int predict_mode;              // PredictMode
+    double alpha;                  // EMA weight of the newest burst
+    double quantile;               // percentile mode: 0.5 is the median
+    Estimator *estimators;         // one per key; NULL until sched_set_predictor()
+    int *estimator_of;
+    Estimator all_bursts;          // fallback for keys with no history yet
+    int *predicted;                // predicted length of each job's next CPU burst
+
+    int tickets_by;                // TicketSource
+    long long runnable_tickets;    // tickets of the jobs that could run now
+    double share_clock;            // CPU handed out per runnable ticket so far
+    long long *lottery_tree;       // lottery: Fenwick tree of the ready jobs' tickets
+    long long lottery_total;
+    int lottery_step;              // highest power of two <= n
+    unsigned long long rng;
+    long long *pass;               // stride: virtual time of each job
+    long long stride_clock;        // stride: pass of the job last dispatched
+
+    int *queue;                    // FIFO ring of ready jobs
+    int head;
+    int count;
+
+    int *burst;                    // next CPU burst, the SJF key
+    int *priority;
+    int *not_ready;                // lottery: not in the ticket tree
+
+    int admission;                 // EDF: AdmissionMode
+    int *deadline_rank;            // position by (deadline, arrival)
+    int *edf_key;                  // ready-heap key for EDF
+    int *ready;                    // EDF ready heap
+    int n_ready;
+    int tree_size;                 // leaves of the admission tree (power of two)
+    long long *tree_work;          // work of admitted jobs under each node
+    long long *tree_slack;         // max over the node's leaves of work so far - deadline
+
+    Slice *slices;
+    int n_slices;
+    int cap_slices;
+
+    // Streaming: jobs are read on demand into recycled slots, so every
+    // per-job array above has n = slots, which grows with the jobs in
+    // flight rather than the length of the trace
+    JobStream *stream;             // NULL when the whole workload is loaded
+    Job *slot_jobs;                // the slots' jobs (r->jobs, writable)
+    int *free_slots;
+    int n_free;
+    int cap_groups;
+    long long taken;               // jobs read into a slot so far
+    int next_rank;                 // arrival rank of the next streamed job
+    StreamTotals totals;
+    FILE *results;                 // optional per-job result rows
+
+#ifdef SCHED_PROFILE
+    Profile prof;
+#endif
+};
+
+typedef struct {
+    long long key;
+    int idx;
+} RankEntry;
+
+static int compare_rank(const void *a, const void *b) {
+    long long x = ((const RankEntry *)a)->key, y = ((const RankEntry *)b)->key;
+    return (x > y) - (x < y);
+}
+
+// Fresh per-run state of the job in slot i
+static inline void sched_reset_job(SchedRun *r, int i) {
+    const Job *job = &r->jobs[i];
+
+    memset(&r->state[i], 0, sizeof(JobState));
+    r->state[i].remaining_time = job->burst_time;
+    r->state[i].burst_left = job->bursts[0];
+    r->burst[i] = job->bursts[0];                   // SJF looks at the next CPU burst
+    r->priority[i] = job->priority;
+    // Arrays of policies other than the one running stay NULL
+    if (r->not_ready) r->not_ready[i] = 1;
+    if (r->cp_rank) r->cp_rank[i] = job->burst_time + job->io_time;
+    if (r->pass) r->pass[i] = 0;
+}
+
+// Group of a job type, added on first sight; workloads have a handful
+static inline int sched_group(SchedRun *r, const char *type) {
+    char name[50];
+    int g;
+
+    type_group(type, name);
+    for (g = 0; g < r->n_groups; g++) {
+        if (strcmp(r->groups[g].name, name) == 0) return g;
+    }
+    if (g == r->cap_groups) {
+        r->cap_groups *= 2;
+        r->groups = realloc(r->groups, sizeof(FairGroup) * r->cap_groups);
+        memset(&r->groups[g], 0, sizeof(FairGroup) * (r->cap_groups - g));
+    }
+    strcpy(r->groups[g].name, name);
+    r->groups[g].weight = default_group_weight(name);
+    r->n_groups++;
+    return g;
+}
+
+// Tickets a job holds under lottery and stride scheduling
+static inline int job_tickets(const SchedRun *r, int idx) {
+    int priority = r->jobs[idx].priority;
+
+    if (r->tickets_by == TICKETS_BY_TYPE) return TICKETS_PER_SHARE * r->groups[r->group_of[idx]].weight;
+    if (priority < 1) priority = 1;
+    if (priority > TICKET_PRIORITY_LEVELS) priority = TICKET_PRIORITY_LEVELS;
+    return TICKETS_PER_SHARE * (TICKET_PRIORITY_LEVELS + 1 - priority);
+}
+
+// Fenwick tree over job indices: node i (1-based) holds the tickets of
+// jobs i - lowbit(i) .. i - 1, so an update or a draw touches O(log n) nodes
+static inline void lottery_add(SchedRun *r, int idx, long long tickets) {
+    for (int i = idx + 1; i <= r->n; i += i & -i) r->lottery_tree[i] += tickets;
+    r->lottery_total += tickets;
+}
+
+// The job holding ticket number `ticket` (0 <= ticket < lottery_total),
+// counting through the ready jobs in index order
+static inline int lottery_find(const SchedRun *r, long long ticket) {
+    int pos = 0;
+
+    for (int step = r->lottery_step; step > 0; step >>= 1) {
+        if (pos + step <= r->n && r->lottery_tree[pos + step] <= ticket) {
+            pos += step;
+            ticket -= r->lottery_tree[pos];
+        }
+    }
+    return pos;
+}
+
+// Rebuild the tree over the ready jobs in O(n), after the slots grow
+static inline void lottery_rebuild(SchedRun *r) {
+    r->lottery_tree = realloc(r->lottery_tree, sizeof(long long) * (r->n + 1));
+    for (r->lottery_step = 1; 2 * r->lottery_step <= r->n; r->lottery_step *= 2) {}
+    r->lottery_tree[0] = 0;
+    r->lottery_total = 0;
+    for (int i = 1; i <= r->n; i++) {
+        r->lottery_tree[i] = r->not_ready[i - 1] ? 0 : job_tickets(r, i - 1);
+        r->lottery_total += r->lottery_tree[i];
+    }
+    for (int i = 1; i <= r->n; i++) {
+        int parent = i + (i & -i);
+        if (parent <= r->n) r->lottery_tree[parent] += r->lottery_tree[i];
+    }
+}
+
+// splitmix64: a fixed seed replays the same draws
+static inline unsigned long long sched_random(SchedRun *r) {
+    unsigned long long z = (r->rng += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static inline void sched_init(SchedRun *r, const Job jobs[], JobState state[], int n,
+                              int total_memory, int quantum) {
+    memset(r, 0, sizeof(*r));
+    r->jobs = jobs;
+    r->state = state;
+    r->n = n;
+    r->total_memory = total_memory;
+    r->available_memory = total_memory;
+    r->quantum = quantum;
+    r->verbose = 1;
+    r->switch_cost = CONTEXT_SWITCH_COST;
+    r->cache_penalty = CACHE_WARMTH_PENALTY;
+    r->last_job = -1;
+
+    r->arrival_order = malloc(sizeof(int) * n);
+    r->queue = malloc(sizeof(int) * n);
+    r->burst = malloc(sizeof(int) * n);
+    r->priority = malloc(sizeof(int) * n);
+    r->arrival_rank = malloc(sizeof(int) * n);
+    r->victims = malloc(sizeof(int) * n);
+    r->ready = malloc(sizeof(int) * n);
+    r->admission = ADMIT_DEFER;
+    r->wait_head = malloc(sizeof(int) * (total_memory + 1));
+    r->wait_tail = malloc(sizeof(int) * (total_memory + 1));
+    for (int m = 0; m <= total_memory; m++) r->wait_head[m] = -1;
+    r->wait_next = malloc(sizeof(int) * n);
+    r->wait_order = malloc(sizeof(long long) * n);
+    for (r->wait_leaves = 1; r->wait_leaves <= total_memory; r->wait_leaves *= 2) {}
+    r->wait_tree = malloc(sizeof(long long) * 2 * r->wait_leaves);
+    for (int i = 0; i < 2 * r->wait_leaves; i++) r->wait_tree[i] = NO_WAIT;
+    r->packing = PACK_FIRST_FIT;
+    wheel_init(&r->io_wheel, n, 0);
+    r->n_devices = 1;
+    r->pending = calloc(n, sizeof(int));
+    r->group_of = malloc(sizeof(int) * n);
+    r->groups = calloc(n, sizeof(FairGroup));
+    r->cap_groups = n;
+    r->inner = INNER_RR;
+    r->rng = LOTTERY_SEED;
+
+    for (int i = 0; i < n; i++) sched_reset_job(r, i);
+
+    // Arrival order, ties by index, in O(n log n) however shuffled the trace
+    RankEntry *order = malloc(sizeof(RankEntry) * (n > 0 ? n : 1));
+    for (int i = 0; i < n; i++) {
+        order[i].key = (long long)jobs[i].arrival_time * n + i;
+        order[i].idx = i;
+    }
+    qsort(order, n, sizeof(RankEntry), compare_rank);
+    for (int k = 0; k < n; k++) r->arrival_order[k] = order[k].idx;
+    free(order);
+    for (int k = 0; k < n; k++) r->arrival_rank[r->arrival_order[k]] = k;
+
+    // Groups in order of first appearance
+    for (int i = 0; i < n; i++) r->group_of[i] = sched_group(r, jobs[i].type);
+}
+
+// Deadline order, ties by arrival; jobs without one sort last.  Only EDF
+// and fair share's EDF inner order need it, and neither streams.
+static inline void sched_rank_deadlines(SchedRun *r) {
+    RankEntry *order = malloc(sizeof(RankEntry) * r->n);
+
+    r->deadline_rank = malloc(sizeof(int) * r->n);
+    for (int i = 0; i < r->n; i++) {
+        order[i].key = (long long)r->jobs[i].deadline * r->n + r->arrival_rank[i];
+        order[i].idx = i;
+    }
+    qsort(order, r->n, sizeof(RankEntry), compare_rank);
+    for (int k = 0; k < r->n; k++) r->deadline_rank[order[k].idx] = k;
+    free(order);
+}
+
+static inline void sched_free(SchedRun *r) {
+    free(r->arrival_order);
+    free(r->queue);
+    free(r->burst);
+    free(r->priority);
+    free(r->not_ready);
+    free(r->scratch);
+    free(r->arrival_rank);
+    free(r->victims);
+    free(r->wait_head);
+    free(r->wait_tail);
+    free(r->wait_next);
+    free(r->wait_order);
+    free(r->wait_tree);
+    wheel_free(&r->io_wheel);
+    free(r->pending);
+    free(r->cp_rank);
+    free(r->cp_key);
+    for (int g = 0; g < r->n_groups; g++) free(r->groups[g].heap);
+    free(r->groups);
+    free(r->group_of);
+    free(r->fair_seq);
+    free(r->estimators);
+    free(r->estimator_of);
+    free(r->predicted);
+    free(r->lottery_tree);
+    free(r->pass);
+    free(r->deadline_rank);
+    free(r->edf_key);
+    free(r->ready);
+    free(r->tree_work);
+    free(r->tree_slack);
+    free(r->slices);
+    if (r->stream) {
+        free(r->slot_jobs);
+        free(r->state);
+        free(r->free_slots);
+    }
+}
+
+// Streaming run over `stream` with STREAM_INITIAL_SLOTS empty slots.  The
+// slots, their state and the group table belong to the run.
+static inline void sched_init_stream(SchedRun *r, JobStream *stream, int total_memory, int quantum) {
+    int n = STREAM_INITIAL_SLOTS;
+    Job *jobs = calloc(n, sizeof(Job));
+
+    sched_init(r, jobs, malloc(sizeof(JobState) * n), n, total_memory, quantum);
+    r->n_groups = 0;                                // the empty slots' blank type
+    memset(r->groups, 0, sizeof(FairGroup));
+    r->stream = stream;
+    r->slot_jobs = jobs;
+    r->free_slots = malloc(sizeof(int) * n);
+    for (int i = n - 1; i >= 0; i--) r->free_slots[r->n_free++] = i;
+}
+
+// Arrays the running policy never allocated stay NULL
+#define SCHED_GROW(array, type) if (array) (array) = realloc((array), sizeof(type) * n)
+
+// Double the slots of a streamed run
+static inline void sched_grow(SchedRun *r) {
+    int old = r->n, n = 2 * old;
+
+    SCHED_GROW(r->slot_jobs, Job);
+    r->jobs = r->slot_jobs;
+    SCHED_GROW(r->state, JobState);
+    SCHED_GROW(r->arrival_order, int);
+    SCHED_GROW(r->queue, int);
+    SCHED_GROW(r->burst, int);
+    SCHED_GROW(r->priority, int);
+    SCHED_GROW(r->not_ready, int);
+    SCHED_GROW(r->scratch, int);
+    SCHED_GROW(r->arrival_rank, int);
+    SCHED_GROW(r->victims, int);
+    SCHED_GROW(r->deadline_rank, int);
+    SCHED_GROW(r->edf_key, int);
+    SCHED_GROW(r->ready, int);
+    SCHED_GROW(r->wait_next, int);
+    SCHED_GROW(r->wait_order, long long);
+    SCHED_GROW(r->pending, int);
+    SCHED_GROW(r->cp_rank, int);
+    SCHED_GROW(r->cp_key, int);
+    SCHED_GROW(r->group_of, int);
+    SCHED_GROW(r->fair_seq, int);
+    SCHED_GROW(r->predicted, int);
+    SCHED_GROW(r->pass, long long);
+    SCHED_GROW(r->free_slots, int);
+    SCHED_GROW(r->io_wheel.next, int);
+    SCHED_GROW(r->io_wheel.time, int);
+    if (r->victim_key) r->victim_key = r->arrival_rank;    // streaming always keys victims by rank
+    memset(&r->pending[old], 0, sizeof(int) * old);
+
+    // Unwrap the FIFO ring: the part that wrapped past the old end moves
+    // to just after it
+    if (r->head + r->count > old) {
+        memcpy(&r->queue[old], r->queue, sizeof(int) * (r->head + r->count - old));
+    }
+
+    for (int i = n - 1; i >= old; i--) r->free_slots[r->n_free++] = i;
+    r->n = n;
+    if (r->lottery_tree) {
+        for (int i = old; i < n; i++) r->not_ready[i] = 1;
+        lottery_rebuild(r);
+    }
+}
+
+#undef SCHED_GROW
+
+// Jobs start only once all their predecessors have completed
+static inline void sched_set_dag(SchedRun *r, const Dag *dag) {
+    r->dag = dag;
+    memcpy(r->pending, dag->indegree, sizeof(int) * r->n);
+    r->cp_rank = malloc(sizeof(int) * r->n);
+    dag_upward_rank(dag, r->jobs, r->cp_rank);
+}
+
+typedef struct {
+    const char *key;
+    int idx;
+} KeyEntry;
+
+static int compare_key(const void *a, const void *b) {
+    const KeyEntry *x = a, *y = b;
+    int c = strcmp(x->key, y->key);
+    return c ? c : x->idx - y->idx;
+}
+
+// Tickets for lottery and stride.  Under any policy the run then also
+// tracks the CPU each job's tickets entitled it to.
+static inline void sched_set_tickets(SchedRun *r, TicketSource by, unsigned long long seed) {
+    r->tickets_by = by;
+    r->rng = seed;
+}
+
+// Jobs with the same type (or name) share one burst estimator
+static inline void sched_set_predictor(SchedRun *r, PredictMode mode, PredictKey by,
+                                       double alpha, int percentile) {
+    KeyEntry *order = malloc(sizeof(KeyEntry) * r->n);
+    int keys = 0;
+
+    r->predict_mode = mode;
+    r->alpha = alpha;
+    r->quantile = percentile / 100.0;
+    r->estimators = calloc(r->n, sizeof(Estimator));
+    r->estimator_of = malloc(sizeof(int) * r->n);
+    for (int i = 0; i < r->n; i++) {
+        order[i].key = by == PREDICT_BY_NAME ? r->jobs[i].name : r->jobs[i].type;
+        order[i].idx = i;
+    }
+    qsort(order, r->n, sizeof(KeyEntry), compare_key);
+    for (int k = 0; k < r->n; k++) {
+        if (k > 0 && strcmp(order[k].key, order[k - 1].key) != 0) keys++;
+        r->estimator_of[order[k].idx] = keys;
+    }
+    free(order);
+}
+
+static inline void queue_push(SchedRun *r, int idx) {
+    r->queue[(r->head + r->count) % r->n] = idx;
+    r->count++;
+}
+
+static inline int queue_pop(SchedRun *r) {
+    int idx;
+
+    if (r->count == 0) return -1;
+    idx = r->queue[r->head];
+    r->head = (r->head + 1) % r->n;
+    r->count--;
+    return idx;
+}
+
+// Binary min-heap of job indices ordered by (key[idx], idx), or by idx
+// alone when key is NULL
+static inline int heap_less(const int key[], int a, int b) {
+    if (key && key[a] != key[b]) return key[a] < key[b];
+    return a < b;
+}
+
+static inline void heap_push(int heap[], int *size, const int key[], int idx) {
+    int pos = (*size)++;
+
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (!heap_less(key, idx, heap[parent])) break;
+        heap[pos] = heap[parent];
+        pos = parent;
+    }
+    heap[pos] = idx;
+}
+
+static inline int heap_pop(int heap[], int *size, const int key[]) {
+    int top = heap[0], last = heap[--(*size)], pos = 0;
+
+    for (;;) {
+        int child = 2 * pos + 1;
+        if (child >= *size) break;
+        if (child + 1 < *size && heap_less(key, heap[child + 1], heap[child])) child++;
+        if (!heap_less(key, heap[child], last)) break;
+        heap[pos] = heap[child];
+        pos = child;
+    }
+    if (*size > 0) heap[pos] = last;
+    return top;
+}
+
+// Add one value to both estimates
+static inline void estimator_add(Estimator *e, double x, double alpha, double quantile) {
+    double step[5] = {0, quantile / 2, quantile, (1 + quantile) / 2, 1};
+    int k;
+
+    e->ema = e->samples == 0 ? x : e->ema + alpha * (x - e->ema);
+    e->samples++;
+
+    // Until there are five samples, keep them sorted
+    if (e->samples <= 5) {
+        int j = (int)e->samples - 1;
+        while (j > 0 && e->height[j - 1] > x) {
+            e->height[j] = e->height[j - 1];
+            j--;
+        }
+        e->height[j] = x;
+        if (e->samples == 5) {
+            for (int i = 0; i < 5; i++) {
+                e->pos[i] = i;
+                e->want[i] = 4 * step[i];
+            }
+        }
+        return;
+    }
+
+    // Cell the sample falls in; the extreme markers track min and max
+    if (x < e->height[0]) {
+        e->height[0] = x;
+        k = 0;
+    } else if (x >= e->height[4]) {
+        if (x > e->height[4]) e->height[4] = x;
+        k = 3;
+    } else {
+        for (k = 0; x >= e->height[k + 1]; k++) {}
+    }
+    for (int i = k + 1; i < 5; i++) e->pos[i]++;
+    for (int i = 0; i < 5; i++) e->want[i] += step[i];
+
+    // Move the middle markers toward their desired positions, piecewise
+    // parabolic when that keeps the heights in order, linear otherwise
+    for (int i = 1; i < 4; i++) {
+        double off = e->want[i] - e->pos[i];
+        if ((off >= 1 && e->pos[i + 1] - e->pos[i] > 1) || (off <= -1 && e->pos[i - 1] - e->pos[i] < -1)) {
+            int d = off > 0 ? 1 : -1;
+            double q = e->height[i] + (double)d / (e->pos[i + 1] - e->pos[i - 1]) *
+                       ((e->pos[i] - e->pos[i - 1] + d) * (e->height[i + 1] - e->height[i]) /
+                            (e->pos[i + 1] - e->pos[i]) +
+                        (e->pos[i + 1] - e->pos[i] - d) * (e->height[i] - e->height[i - 1]) /
+                            (e->pos[i] - e->pos[i - 1]));
+            if (q <= e->height[i - 1] || q >= e->height[i + 1]) {
+                q = e->height[i] + d * (e->height[i + d] - e->height[i]) / (e->pos[i + d] - e->pos[i]);
+            }
+            e->height[i] = q;
+            e->pos[i] += d;
+        }
+    }
+}
+
+static inline double estimator_quantile(const Estimator *e, double quantile) {
+    int rank;
+
+    if (e->samples >= 5) return e->height[2];
+    rank = (int)(quantile * e->samples + 0.999999);       // nearest rank of the few seen
+    return e->height[rank > 0 ? rank - 1 : 0];
+}
+
+// Arrival time of the next job not yet admitted, INT_MAX if none
+static inline int next_arrival_time(const SchedRun *r) {
+    if (r->stream) return r->stream->has_next ? r->stream->next.arrival_time : INT_MAX;
+    return r->next_arrival < r->n ? r->jobs[r->arrival_order[r->next_arrival]].arrival_time : INT_MAX;
+}
+
+// Jobs not yet completed or rejected, including ones still to arrive
+static inline int sched_running(const SchedRun *r) {
+    if (r->stream) return r->stream->has_next || r->completed < r->taken;
+    return r->completed < r->n;
+}
+
+// Streaming: the job after the one just retired may reuse its slot, so
+// nothing may still point at the old occupant
+static inline void release_slot(SchedRun *r, int idx) {
+    if (r->last_job == idx) r->last_job = -2;       // a switch, but to no known job
+    if (r->n_slices > 0 && r->slices[r->n_slices - 1].job == idx) r->slices[r->n_slices - 1].job = -1;
+    r->free_slots[r->n_free++] = idx;
+}
+
+// Take the next arrival into a job slot: its index in a loaded workload,
+// or a recycled (or new) slot when streaming
+static inline int take_arrival(SchedRun *r) {
+    int idx;
+
+    if (!r->stream) return r->arrival_order[r->next_arrival++];
+    if (r->n_free == 0) sched_grow(r);
+    idx = r->free_slots[--r->n_free];
+    r->slot_jobs[idx] = r->stream->next;
+    sched_reset_job(r, idx);
+    r->arrival_rank[idx] = r->next_rank++;
+    r->group_of[idx] = sched_group(r, r->jobs[idx].type);
+    r->taken++;
+    stream_advance(r->stream);
+    return idx;
+}
+
+static inline void stream_percentiles(Estimator e[3], int value) {
+    for (int k = 0; k < 3; k++) estimator_add(&e[k], value, 1, STREAM_PERCENTILES[k] / 100.0);
+}
+
+// Streaming: fold a finished (or rejected) job into the run totals and
+// write its result row
+static inline void retire_job(SchedRun *r, int idx) {
+    const Job *job = &r->jobs[idx];
+    const JobState *st = &r->state[idx];
+    StreamTotals *t = &r->totals;
+
+    if (job->deadline != NO_DEADLINE) t->with_deadline++;
+    if (st->rejected) {
+        t->rejected++;
+        if (r->results) fprintf(r->results, "%s,%s,%d,,,,,,rejected\n", job->name, job->type, job->arrival_time);
+        return;
+    }
+    t->served++;
+    t->total_wt += st->waiting_time;
+    t->total_tat += st->turnaround_time;
+    t->total_rt += st->response_time;
+    t->total_burst += job->burst_time;
+    t->total_swap_time += st->total_swap_time;
+    if (st->completion_time > t->makespan) t->makespan = st->completion_time;
+    stream_percentiles(t->tat, st->turnaround_time);
+    stream_percentiles(t->rt, st->response_time);
+    if (job->deadline != NO_DEADLINE) {
+        int late = st->completion_time > job->deadline ? st->completion_time - job->deadline : 0;
+        if (late > 0) t->missed++;
+        t->total_tardiness += late;
+        if (late > t->max_tardiness) t->max_tardiness = late;
+        stream_percentiles(t->tardiness, late);
+    }
+    if (r->results) {
+        fprintf(r->results, "%s,%s,%d,%d,%d,%d,%d,%d,%s\n", job->name, job->type, job->arrival_time,
+                st->start_time, st->completion_time, st->turnaround_time, st->waiting_time,
+                st->response_time, job->deadline != NO_DEADLINE && st->completion_time > job->deadline ?
+                "missed" : "done");
+    }
+}
+
+// Track which groups have work the CPU could run right now.  With
+// tickets, a job is entitled to (its tickets / all runnable tickets) of
+// the CPU while it is runnable.  share_clock sums that fraction per ticket
+// over every slice, so a job's entitlement is its tickets times how far
+// the clock moved while it was runnable.
+static inline void set_runnable(SchedRun *r, int idx, int runnable) {
+    JobState *st = &r->state[idx];
+
+    if (st->runnable != runnable) {
+        st->runnable = runnable;
+        r->groups[r->group_of[idx]].runnable += runnable ? 1 : -1;
+        if (r->tickets_by != TICKETS_NONE) {
+            int tickets = job_tickets(r, idx);
+            if (runnable) {
+                st->share_mark = r->share_clock;
+                r->runnable_tickets += tickets;
+            } else {
+                st->entitled += tickets * (r->share_clock - st->share_mark);
+                r->runnable_tickets -= tickets;
+            }
+        }
+    }
+}
+
+// Set a job's remaining work in EDF's admission tree; 0 removes it
+static inline void edf_tree_set(SchedRun *r, int idx, int work) {
+    int pos = r->tree_size + r->deadline_rank[idx];
+
+    r->tree_work[pos] = work;
+    r->tree_slack[pos] = work > 0 ? work - (long long)r->jobs[idx].deadline : EDF_EMPTY;
+    for (pos /= 2; pos >= 1; pos /= 2) {
+        long long left = r->tree_slack[2 * pos];
+        long long right = r->tree_work[2 * pos] + r->tree_slack[2 * pos + 1];
+        r->tree_work[pos] = r->tree_work[2 * pos] + r->tree_work[2 * pos + 1];
+        r->tree_slack[pos] = left > right ? left : right;
+    }
+}
+
+// A rejected job is done, and work EDF admitted for it no longer counts
+// against the deadlines of the jobs that remain
+static inline void mark_rejected(SchedRun *r, int idx) {
+    r->state[idx].rejected = 1;
+    r->state[idx].is_completed = 1;
+    r->completed++;
+    r->stats.rejected++;
+    set_runnable(r, idx, 0);
+    if (r->tree_work && r->tree_work[r->tree_size + r->deadline_rank[idx]] != 0) edf_tree_set(r, idx, 0);
+}
+
+// A rejected job never runs, so neither can anything that depends on it
+static inline void reject_job(SchedRun *r, int idx) {
+    int *stack, top = 0;
+
+    mark_rejected(r, idx);
+    if (r->stream) {
+        retire_job(r, idx);
+        release_slot(r, idx);
+    }
+    if (!r->dag) return;
+
+    stack = malloc(sizeof(int) * r->n);
+    stack[top++] = idx;
+    while (top > 0) {
+        int u = stack[--top];
+        for (int k = r->dag->succ_start[u]; k < r->dag->succ_start[u + 1]; k++) {
+            int v = r->dag->succ[k];
+            if (r->state[v].rejected) continue;
+            mark_rejected(r, v);
+            SCHED_LOG(r, "Time %d: Rejected process %s (depends on rejected %s)\n",
+                      r->current_time, r->jobs[v].name, r->jobs[u].name);
+            stack[top++] = v;
+        }
+    }
+    free(stack);
+}
+
+// Next time a job joins the ready set: an arrival or an I/O completion
+static inline int next_event_time(SchedRun *r) {
+    int next = wheel_earliest(&r->io_wheel);
+    int arrival = next_arrival_time(r);
+
+    return arrival < next ? arrival : next;
+}
+
+static inline void record_slice(SchedRun *r, int idx, int start, int end) {
+    if (r->stream) r->n_slices = 0;                // only the latest slice is kept
+    if (r->n_slices == r->cap_slices) {
+        r->cap_slices = r->cap_slices ? r->cap_slices * 2 : 64;
+        r->slices = realloc(r->slices, sizeof(Slice) * r->cap_slices);
+    }
+    r->slices[r->n_slices].job = idx;
+    r->slices[r->n_slices].start = start;
+    r->slices[r->n_slices].end = end;
+    r->n_slices++;
+}
+
+// ─────────────────────────────────────────────────────────
+// Policies
+// ─────────────────────────────────────────────────────────
+
+static inline void enqueue_fifo(SchedRun *r, int idx) {
+    queue_push(r, idx);
+}
+
+static inline int select_fifo(SchedRun *r) {
+    return queue_pop(r);
+}
+
+// Ready heap in r->ready, ordered by `before`.  Each policy passes a
+// constant, so the comparison is inlined into its copy of the loop.
+typedef int (*ReadyOrder)(const SchedRun *r, int a, int b);
+
+static inline void ready_push(SchedRun *r, int idx, ReadyOrder before) {
+    int pos = r->n_ready++;
+
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (!before(r, idx, r->ready[parent])) break;
+        r->ready[pos] = r->ready[parent];
+        pos = parent;
+    }
+    r->ready[pos] = idx;
+}
+
+static inline int ready_pop(SchedRun *r, ReadyOrder before) {
+    int top, last, pos = 0;
+
+    if (r->n_ready == 0) return -1;
+    top = r->ready[0];
+    last = r->ready[--r->n_ready];
+    for (;;) {
+        int child = 2 * pos + 1;
+        if (child >= r->n_ready) break;
+        if (child + 1 < r->n_ready && before(r, r->ready[child + 1], r->ready[child])) child++;
+        if (!before(r, r->ready[child], last)) break;
+        r->ready[pos] = r->ready[child];
+        pos = child;
+    }
+    if (r->n_ready > 0) r->ready[pos] = last;
+    return top;
+}
+
+// Shortest burst; equal bursts go to the earliest arrival
+static inline int shortest_before(const SchedRun *r, int a, int b) {
+    if (r->burst[a] != r->burst[b]) return r->burst[a] < r->burst[b];
+    return r->arrival_rank[a] < r->arrival_rank[b];
+}
+
+// Lowest priority number; equal priorities go to the shortest burst, then
+// the earliest arrival
+static inline int priority_before(const SchedRun *r, int a, int b) {
+    if (r->priority[a] != r->priority[b]) return r->priority[a] < r->priority[b];
+    return shortest_before(r, a, b);
+}
+
+static inline void enqueue_shortest(SchedRun *r, int idx) {
+    ready_push(r, idx, shortest_before);
+}
+
+static inline int select_shortest(SchedRun *r) {
+    return ready_pop(r, shortest_before);
+}
+
+static inline void enqueue_priority(SchedRun *r, int idx) {
+    ready_push(r, idx, priority_before);
+}
+
+static inline int select_highest_priority(SchedRun *r) {
+    return ready_pop(r, priority_before);
+}
+
+static inline int slice_to_completion(SchedRun *r, int idx) {
+    return r->state[idx].remaining_time;
+}
+
+static inline int slice_quantum(SchedRun *r, int idx) {
+    int remaining = r->state[idx].remaining_time;
+    return remaining < r->quantum ? remaining : r->quantum;
+}
+
+// k-th smallest of v[0..n-1] (Hoare quickselect, reorders v)
+static inline int select_kth(int v[], int n, int k) {
+    int lo = 0, hi = n - 1;
+
+    while (lo < hi) {
+        int pivot = v[(lo + hi) / 2], i = lo, j = hi;
+        while (i <= j) {
+            while (v[i] < pivot) i++;
+            while (v[j] > pivot) j--;
+            if (i <= j) {
+                int tmp = v[i]; v[i] = v[j]; v[j] = tmp;
+                i++;
+                j--;
+            }
+        }
+        if (k <= j) hi = j;
+        else if (k >= i) lo = i;
+        else break;
+    }
+    return v[k];
+}
+
+// Adaptive RR: at the start of every round (one pass over the jobs that
+// are ready when it begins) the quantum becomes the median remaining time
+// of the ready jobs, so about half of them finish without a preemption,
+// clamped to [ADAPTIVE_MIN_QUANTUM, ADAPTIVE_MAX_QUANTUM].  A long queue
+// shrinks it further so one round stays within ADAPTIVE_ROUND_TARGET.
+static inline int slice_adaptive(SchedRun *r, int idx) {
+    int remaining = r->state[idx].remaining_time;
+
+    if (r->round_left == 0) {
+        int ready = 0, median, q;
+
+        r->scratch[ready++] = remaining;
+        for (int k = 0; k < r->count; k++) {
+            r->scratch[ready++] = r->state[r->queue[(r->head + k) % r->n]].remaining_time;
+        }
+        median = select_kth(r->scratch, ready, ready / 2);
+
+        q = median;
+        if (q * ready > ADAPTIVE_ROUND_TARGET) q = ADAPTIVE_ROUND_TARGET / ready;
+        if (q < ADAPTIVE_MIN_QUANTUM) q = ADAPTIVE_MIN_QUANTUM;
+        if (q > ADAPTIVE_MAX_QUANTUM) q = ADAPTIVE_MAX_QUANTUM;
+
+        r->round_quantum = q;
+        r->round_left = ready;
+        SCHED_LOG(r, "Time %d: New round: %d ready, median remaining %d -> quantum %d\n",
+                  r->current_time, ready, median, q);
+    }
+    r->round_left--;
+    return remaining < r->round_quantum ? remaining : r->round_quantum;
+}
+
+static inline void init_adaptive(SchedRun *r) {
+    r->scratch = malloc(sizeof(int) * r->n);
+}
+
+// Earliest Deadline First.  Ready jobs sit in a heap keyed by deadline
+// rank; deferred jobs rank after every guaranteed one and jobs without a
+// deadline after those.  A slice lasts until the next arrival, so a new
+// job with an earlier deadline takes the CPU at once.
+//
+// Admission keeps a segment tree over deadline ranks holding the work left
+// of every admitted, unfinished job.  A node stores its total work and the
+// largest (work up to a leaf - that leaf's deadline) inside it, so the
+// exact single-CPU EDF test "every job finishes by its deadline" is
+// now + max <= 0.  A newcomer can only delay jobs at or after its own
+// rank, so only that suffix is checked: O(log n) per arrival.
+static inline int edf_tracked(const SchedRun *r, int idx) {
+    return r->jobs[idx].deadline != NO_DEADLINE && !r->state[idx].deferred && !r->state[idx].rejected;
+}
+
+// Largest (work up to a leaf - deadline) over leaves from `from` on,
+// relative to the start of the node's range [lo, hi)
+static inline long long edf_worst_from(const SchedRun *r, int node, int lo, int hi, int from) {
+    int mid = (lo + hi) / 2;
+    long long left, right;
+
+    if (hi <= from) return EDF_EMPTY;
+    if (lo >= from) return r->tree_slack[node];
+    left = edf_worst_from(r, 2 * node, lo, mid, from);
+    right = r->tree_work[2 * node] + edf_worst_from(r, 2 * node + 1, mid, hi, from);
+    return left > right ? left : right;
+}
+
+// The job that ran last may have finished or shrunk since it was entered
+static inline void edf_refresh(SchedRun *r) {
+    if (r->last_job >= 0 && edf_tracked(r, r->last_job)) {
+        edf_tree_set(r, r->last_job, r->state[r->last_job].remaining_time);
+    }
+}
+
+static inline void enqueue_edf(SchedRun *r, int idx) {
+    const Job *job = &r->jobs[idx];
+    JobState *st = &r->state[idx];
+    int rank = r->deadline_rank[idx];
+
+    edf_refresh(r);
+    // Tested once, on arrival; a job back from the memory queue keeps its verdict
+    if (!st->started && !st->deferred && job->deadline != NO_DEADLINE &&
+        r->tree_work[r->tree_size + rank] == 0) {
+        // Work to finish includes the swap-in still ahead of it
+        edf_tree_set(r, idx, st->remaining_time + SWAP_TIME);
+        if (r->admission != ADMIT_NONE &&
+            r->current_time + edf_worst_from(r, 1, 0, r->tree_size, rank) > 0) {
+            edf_tree_set(r, idx, 0);
+            if (r->admission == ADMIT_REJECT) {
+                SCHED_LOG(r, "Time %d: Rejected process %s (deadline %d cannot be met)\n",
+                          r->current_time, job->name, job->deadline);
+                reject_job(r, idx);
+                return;
+            }
+            st->deferred = 1;
+            r->stats.deferred++;
+            SCHED_LOG(r, "Time %d: Deferred process %s (deadline %d cannot be guaranteed)\n",
+                      r->current_time, job->name, job->deadline);
+        }
+    }
+    if (job->deadline == NO_DEADLINE) rank += 2 * r->n;
+    else if (st->deferred) rank += r->n;
+    r->edf_key[idx] = rank;
+    heap_push(r->ready, &r->n_ready, r->edf_key, idx);
+}
+
+static inline int select_earliest_deadline(SchedRun *r) {
+    edf_refresh(r);
+    return r->n_ready > 0 ? heap_pop(r->ready, &r->n_ready, r->edf_key) : -1;
+}
+
+// Ends at the next arrival or I/O completion; jobs that became ready
+// during the swap-in are admitted after a single unit
+static inline int slice_to_next_arrival(SchedRun *r, int idx) {
+    int run = r->state[idx].remaining_time;
+    int next = next_event_time(r);
+
+    if (next != INT_MAX) {
+        int gap = next - r->current_time;
+        if (gap < 1) gap = 1;
+        if (gap < run) run = gap;
+    }
+    return run;
+}
+
+static inline int edf_preempted(SchedRun *r, int idx) {
+    return r->ready[0] != idx;
+}
+
+static inline void init_edf(SchedRun *r) {
+    sched_rank_deadlines(r);
+    r->edf_key = malloc(sizeof(int) * r->n);
+    for (r->tree_size = 1; r->tree_size < r->n; r->tree_size *= 2) {}
+    r->tree_work = calloc(2 * r->tree_size, sizeof(long long));
+    r->tree_slack = malloc(sizeof(long long) * 2 * r->tree_size);
+    for (int i = 0; i < 2 * r->tree_size; i++) r->tree_slack[i] = EDF_EMPTY;
+}
+
+// Critical path first (HEFT-style list scheduling): the ready job with the
+// largest upward rank, i.e. the one heading the longest remaining chain of
+// dependent work, so successors are released as early as possible
+static inline void enqueue_critical(SchedRun *r, int idx) {
+    r->cp_key[idx] = -r->cp_rank[idx];
+    heap_push(r->ready, &r->n_ready, r->cp_key, idx);
+}
+
+static inline int select_critical(SchedRun *r) {
+    return r->n_ready > 0 ? heap_pop(r->ready, &r->n_ready, r->cp_key) : -1;
+}
+
+// Without dependencies a job's upward rank is just its own work
+static inline void init_critical(SchedRun *r) {
+    r->cp_key = malloc(sizeof(int) * r->n);
+    if (!r->cp_rank) {
+        r->cp_rank = malloc(sizeof(int) * r->n);
+        for (int i = 0; i < r->n; i++) r->cp_rank[i] = r->jobs[i].burst_time + r->jobs[i].io_time;
+    }
+}
+
+// Shortest predicted burst first.  A real scheduler cannot see
+// burst_time, so each job is ranked by an estimate of its next CPU burst
+// made from the bursts its key has already run, taken when the job
+// becomes ready.  Unseen keys fall back to the history of all jobs.
+static inline int predict_burst(const SchedRun *r, int idx) {
+    const Estimator *e;
+    double guess;
+
+    if (!r->estimators) return PREDICT_INITIAL_BURST;
+    e = &r->estimators[r->estimator_of[idx]];
+    if (e->samples == 0) e = &r->all_bursts;
+    if (e->samples == 0) return PREDICT_INITIAL_BURST;
+    guess = r->predict_mode == PREDICT_EMA ? e->ema : estimator_quantile(e, r->quantile);
+    return guess < 1 ? 1 : (int)(guess + 0.5);
+}
+
+// A CPU burst just ended: score the prediction it ran under and learn
+// from its real length
+static inline void observe_burst(SchedRun *r, int idx) {
+    const Job *job = &r->jobs[idx];
+    int actual = job->bursts[r->state[idx].burst_index];
+    int error = r->predicted[idx] - actual;
+    Estimator *e = &r->estimators[r->estimator_of[idx]];
+
+    r->stats.predicted_bursts++;
+    r->stats.predict_error += error;
+    r->stats.predict_abs_error += error < 0 ? -error : error;
+    estimator_add(e, actual, r->alpha, r->quantile);
+    estimator_add(&r->all_bursts, actual, r->alpha, r->quantile);
+}
+
+static inline void enqueue_predicted(SchedRun *r, int idx) {
+    r->predicted[idx] = predict_burst(r, idx);
+    heap_push(r->ready, &r->n_ready, r->predicted, idx);
+}
+
+static inline int select_predicted(SchedRun *r) {
+    return r->n_ready > 0 ? heap_pop(r->ready, &r->n_ready, r->predicted) : -1;
+}
+
+static inline void init_predicted(SchedRun *r) {
+    r->predicted = malloc(sizeof(int) * r->n);
+}
+
+// Hierarchical weighted fair share.  The top level runs the group with
+// the least virtual time (CPU received / weight) among those with ready
+// jobs.  A group that was idle starts from the clock of the last group
+// served rather than its old, lower vtime, so idling banks no credit.
+// Inside a group the inner policy's order applies, and every dispatch is
+// one quantum, so groups interleave at the weights' ratio.
+static inline int fair_before(const SchedRun *r, int a, int b) {
+    switch (r->inner) {
+    case INNER_SJF:
+        return shortest_before(r, a, b);
+    case INNER_PRIORITY:
+        return priority_before(r, a, b);
+    case INNER_EDF:
+        return r->deadline_rank[a] < r->deadline_rank[b];
+    default:
+        return r->fair_seq[a] < r->fair_seq[b];
+    }
+}
+
+static inline void enqueue_fair(SchedRun *r, int idx) {
+    FairGroup *grp = &r->groups[r->group_of[idx]];
+    const Slice *last = r->n_slices > 0 ? &r->slices[r->n_slices - 1] : NULL;
+    int requeue = last && last->job == idx && last->end == r->current_time;
+    int pos;
+
+    // FCFS keeps its place when the quantum runs out; RR goes to the back
+    if (!(requeue && r->inner == INNER_FCFS)) r->fair_seq[idx] = r->next_seq++;
+    if (grp->n_ready == 0 && grp->vtime < r->fair_clock) grp->vtime = r->fair_clock;
+
+    if (grp->n_ready == grp->cap) {
+        grp->cap = grp->cap ? grp->cap * 2 : 16;
+        grp->heap = realloc(grp->heap, sizeof(int) * grp->cap);
+    }
+    pos = grp->n_ready++;
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (!fair_before(r, idx, grp->heap[parent])) break;
+        grp->heap[pos] = grp->heap[parent];
+        pos = parent;
+    }
+    grp->heap[pos] = idx;
+}
+
+static inline int select_fair(SchedRun *r) {
+    FairGroup *grp = NULL;
+    int top, last, pos = 0;
+
+    for (int g = 0; g < r->n_groups; g++) {
+        if (r->groups[g].n_ready > 0 && (!grp || r->groups[g].vtime < grp->vtime)) grp = &r->groups[g];
+    }
+    if (!grp) return -1;
+    r->fair_clock = grp->vtime;
+
+    top = grp->heap[0];
+    last = grp->heap[--grp->n_ready];
+    for (;;) {
+        int child = 2 * pos + 1;
+        if (child >= grp->n_ready) break;
+        if (child + 1 < grp->n_ready && fair_before(r, grp->heap[child + 1], grp->heap[child])) child++;
+        if (!fair_before(r, grp->heap[child], last)) break;
+        grp->heap[pos] = grp->heap[child];
+        pos = child;
+    }
+    if (grp->n_ready > 0) grp->heap[pos] = last;
+    return top;
+}
+
+static inline int slice_fair(SchedRun *r, int idx) {
+    FairGroup *grp = &r->groups[r->group_of[idx]];
+    int run = r->state[idx].burst_left < r->quantum ? r->state[idx].burst_left : r->quantum;
+
+    grp->vtime += run * FAIR_SCALE / grp->weight;
+    return run;
+}
+
+static inline void init_fair(SchedRun *r) {
+    r->fair_seq = malloc(sizeof(int) * r->n);
+    if (r->inner == INNER_EDF) sched_rank_deadlines(r);
+}
+
+// Lottery: each dispatch draws one of the ready jobs' tickets uniformly
+// at random, so a job's chance of the next quantum is its ticket share.
+// The Fenwick tree makes the draw and every enqueue O(log n).
+static inline void enqueue_lottery(SchedRun *r, int idx) {
+    r->not_ready[idx] = 0;
+    lottery_add(r, idx, job_tickets(r, idx));
+}
+
+static inline int select_lottery(SchedRun *r) {
+    int idx;
+
+    if (r->lottery_total == 0) return -1;
+    idx = lottery_find(r, (long long)(sched_random(r) % (unsigned long long)r->lottery_total));
+    r->not_ready[idx] = 1;
+    lottery_add(r, idx, -job_tickets(r, idx));
+    return idx;
+}
+
+static inline void init_lottery(SchedRun *r) {
+    r->not_ready = malloc(sizeof(int) * r->n);
+    for (int i = 0; i < r->n; i++) r->not_ready[i] = 1;
+    r->lottery_tree = calloc(r->n + 1, sizeof(long long));
+    for (r->lottery_step = 1; 2 * r->lottery_step <= r->n; r->lottery_step *= 2) {}
+}
+
+// Stride: the deterministic counterpart.  Each job's pass advances by
+// STRIDE_SCALE / tickets per unit of CPU it receives, and the ready job
+// with the lowest pass runs next (ties by arrival).  A job joining the
+// ready set starts no lower than the pass last dispatched, so time spent
+// blocked or not yet arrived banks no credit.
+static inline int stride_before(const SchedRun *r, int a, int b) {
+    if (r->pass[a] != r->pass[b]) return r->pass[a] < r->pass[b];
+    return r->arrival_rank[a] < r->arrival_rank[b];
+}
+
+static inline void enqueue_stride(SchedRun *r, int idx) {
+    if (r->pass[idx] < r->stride_clock) r->pass[idx] = r->stride_clock;
+    ready_push(r, idx, stride_before);
+}
+
+static inline int select_stride(SchedRun *r) {
+    int top = ready_pop(r, stride_before);
+
+    if (top >= 0) r->stride_clock = r->pass[top];
+    return top;
+}
+
+static inline int slice_stride(SchedRun *r, int idx) {
+    int run = r->state[idx].burst_left < r->quantum ? r->state[idx].burst_left : r->quantum;
+
+    r->pass[idx] += run * STRIDE_SCALE / job_tickets(r, idx);
+    return run;
+}
+
+static inline void init_stride(SchedRun *r) {
+    r->pass = calloc(r->n, sizeof(long long));
+}
+
+static const Policy FCFS_POLICY = {
+    "fcfs", "FCFS", "First Come First Served", "",
+    "This demonstrates the convoy effect in FCFS scheduling\n"
+    "with memory swapping. Long-running batch analytics\n"
+    "processes block short critical web requests, causing\n"
+    "poor response times for interactive workloads.\n",
+    0, VICTIMS_BY_ARRIVAL, enqueue_fifo, select_fifo, slice_to_completion, NULL, NULL
+};
+
+static const Policy SJF_POLICY = {
+    "sjf", "SJF", "Shortest Job First - Non-Preemptive", " [Shortest Job]",
+    "SJF prioritizes shorter jobs, reducing average waiting\n"
+    "time compared to FCFS. Critical short web requests are\n"
+    "served faster, but long-running processes may starve.\n",
+    0, VICTIMS_BY_INDEX, enqueue_shortest, select_shortest, slice_to_completion, NULL, NULL
+};
+
+static const Policy RR_POLICY = {
+    "rr", "Round Robin", "Preemptive", "",
+    "Round Robin provides fair CPU allocation with time quantum.\n"
+    "All processes get equal opportunity, preventing starvation.\n"
+    "Good for interactive systems but has context switch overhead.\n",
+    1, VICTIMS_BY_INDEX, enqueue_fifo, select_fifo, slice_quantum, NULL, NULL
+};
+
+static const Policy RR_ADAPTIVE_POLICY = {
+    "rr-adaptive", "Adaptive Round Robin", "Preemptive, Adaptive Quantum", "",
+    "Adaptive Round Robin sizes each round's quantum from the\n"
+    "remaining work in the ready queue. Long batch jobs are\n"
+    "preempted less often, while a busy queue keeps rounds short\n"
+    "so interactive requests still get the CPU quickly.\n",
+    1, VICTIMS_BY_INDEX, enqueue_fifo, select_fifo, slice_adaptive, NULL, init_adaptive
+};
+
+static const Policy PRIORITY_POLICY = {
+    "priority", "Priority", "Priority - Non-Preemptive", " [Highest Priority]",
+    "Priority scheduling executes critical web requests first,\n"
+    "improving response time for high-priority tasks. However,\n"
+    "low-priority batch jobs may experience starvation.\n",
+    0, VICTIMS_BY_INDEX, enqueue_priority, select_highest_priority, slice_to_completion, NULL, NULL
+};
+
+static const Policy EDF_POLICY = {
+    "edf", "EDF", "Earliest Deadline First - Preemptive", " [Earliest Deadline]",
+    "EDF always runs the job whose deadline is nearest, so\n"
+    "critical web requests preempt batch work the moment they\n"
+    "arrive. Admission control only guarantees deadlines it can\n"
+    "keep: work that would push an admitted job past its deadline\n"
+    "is rejected or deferred behind the guaranteed jobs.\n",
+    1, VICTIMS_BY_INDEX, enqueue_edf, select_earliest_deadline, slice_to_next_arrival, edf_preempted, init_edf
+};
+
+static const Policy PSJF_POLICY = {
+    "psjf", "Predicted SJF", "Shortest Predicted Burst First - Non-Preemptive", " [Shortest Predicted]",
+    "Predicted SJF orders jobs by an estimate learned from the\n"
+    "bursts already run, not by the true burst time. Job types\n"
+    "with steady bursts are ranked almost as well as by oracle\n"
+    "SJF; mispredicted jobs cost waiting time until the estimate\n"
+    "catches up.\n",
+    0, VICTIMS_BY_INDEX, enqueue_predicted, select_predicted, slice_to_completion, NULL, init_predicted
+};
+
+static const Policy FAIR_POLICY = {
+    "fair", "Weighted Fair Share", "Hierarchical Weighted Fair Share", " [Fair Share]",
+    "Fair share gives every job type a CPU weight. Web traffic\n"
+    "gets most of the CPU while it is busy, but batch analytics\n"
+    "still receives its weighted share and cannot starve, and\n"
+    "batch work cannot monopolise the CPU the way it does under\n"
+    "FCFS.\n",
+    1, VICTIMS_BY_INDEX, enqueue_fair, select_fair, slice_fair, NULL, init_fair
+};
+
+static const Policy CPATH_POLICY = {
+    "cpath", "Critical Path", "Critical Path First - Non-Preemptive", " [Critical Path]",
+    "Critical-path scheduling runs the job that heads the longest\n"
+    "chain of dependent work first. Database and batch jobs that\n"
+    "feed reports and data processing go early, so the dependent\n"
+    "jobs are released sooner and the pipeline finishes earlier.\n",
+    0, VICTIMS_BY_INDEX, enqueue_critical, select_critical, slice_to_completion, NULL, init_critical
+};
+
+static const Policy LOTTERY_POLICY = {
+    "lottery", "Lottery", "Proportional Share - Preemptive, Randomised", " [Lottery]",
+    "Lottery scheduling gives each job CPU in proportion to its\n"
+    "tickets on average, and no job with tickets can starve.\n"
+    "Over short runs the random draws wander from the ticket\n"
+    "shares; the error shrinks as the number of quanta grows.\n",
+    1, VICTIMS_BY_INDEX, enqueue_lottery, select_lottery, slice_quantum, NULL, init_lottery
+};
+
+static const Policy STRIDE_POLICY = {
+    "stride", "Stride", "Proportional Share - Preemptive, Deterministic", " [Stride]",
+    "Stride scheduling gives each job CPU in proportion to its\n"
+    "tickets deterministically. Its share error stays within a\n"
+    "few quanta however long the run, where lottery's grows\n"
+    "with the square root of the number of draws.\n",
+    1, VICTIMS_BY_INDEX, enqueue_stride, select_stride, slice_stride, NULL, init_stride
+};
+
+// ─────────────────────────────────────────────────────────
+// Event loop
+// ─────────────────────────────────────────────────────────
+
+// Every enqueue goes through here, so a profile can time the hook
+static SCHED_INLINE void enqueue_job(SchedRun *r, const Policy *p, int idx) {
+    PROF_ENTER(r, PROF_ENQUEUE);
+    p->enqueue(r, idx);
+    PROF_LEAVE(r);
+}
+
+// Move everything that became ready by now into the policy, in time
+// order: arrivals, and blocked jobs whose I/O has finished (arrivals first
+// on a tie)
+static SCHED_INLINE void admit_arrivals(SchedRun *r, const Policy *p) {
+    PROF_ENTER(r, PROF_ARRIVALS);
+    for (;;) {
+        int arrival = next_arrival_time(r);
+        int io = wheel_earliest(&r->io_wheel);
+
+        if (arrival <= io && arrival <= r->current_time) {
+            int idx = take_arrival(r);
+            if (r->state[idx].rejected) continue;
+            if (r->pending[idx] > 0) {
+                SCHED_LOG(r, "Time %d: Process %s arrived, waiting for %d predecessor(s)\n",
+                          arrival, r->jobs[idx].name, r->pending[idx]);
+                continue;
+            }
+            set_runnable(r, idx, 1);
+            enqueue_job(r, p, idx);
+        } else if (io <= r->current_time) {
+            int idx = wheel_pop(&r->io_wheel);
+            SCHED_LOG(r, "Time %d: Process %s finished I/O\n", io, r->jobs[idx].name);
+            set_runnable(r, idx, 1);
+            enqueue_job(r, p, idx);
+        } else {
+            break;
+        }
+    }
+    PROF_LEAVE(r);
+}
+
+// Split a slice among the groups with runnable work, by weight, and
+// credit the CPU to the group that got it
+static SCHED_INLINE void account_share(SchedRun *r, int idx, int run) {
+    long long total_weight = 0;
+
+    for (int g = 0; g < r->n_groups; g++) {
+        if (r->groups[g].runnable > 0) total_weight += r->groups[g].weight;
+    }
+    for (int g = 0; g < r->n_groups; g++) {
+        if (r->groups[g].runnable > 0) {
+            r->groups[g].entitled += (double)run * r->groups[g].weight / total_weight;
+        }
+    }
+    r->groups[r->group_of[idx]].used += run;
+    if (r->runnable_tickets > 0) r->share_clock += (double)run / r->runnable_tickets;
+}
+
+// A job completed: successors that have arrived and have no other
+// unfinished predecessor become ready.  O(out-degree).
+static SCHED_INLINE void release_successors(SchedRun *r, const Policy *p, int idx) {
+    for (int k = r->dag->succ_start[idx]; k < r->dag->succ_start[idx + 1]; k++) {
+        int v = r->dag->succ[k];
+        if (--r->pending[v] > 0 || r->state[v].rejected) continue;
+        if (r->jobs[v].arrival_time <= r->current_time) {
+            r->stats.dependency_wait += r->current_time - r->jobs[v].arrival_time;
+            SCHED_LOG(r, "Time %d: Process %s released (predecessors done)\n",
+                      r->current_time, r->jobs[v].name);
+            set_runnable(r, v, 1);
+            enqueue_job(r, p, v);
+        }
+    }
+}
+
+// A CPU burst has ended with more bursts to go: queue the I/O on the device
+// that frees up first and block the job until it is done
+static SCHED_INLINE void start_io(SchedRun *r, int idx) {
+    const Job *job = &r->jobs[idx];
+    JobState *st = &r->state[idx];
+    int length = job->bursts[++st->burst_index];
+    int dev = 0, begin;
+
+    for (int d = 1; d < r->n_devices; d++) {
+        if (r->device_free[d] < r->device_free[dev]) dev = d;
+    }
+    begin = r->device_free[dev] > r->current_time ? r->device_free[dev] : r->current_time;
+    r->device_free[dev] = begin + length;
+    st->io_done = begin + length;
+    st->blocked_time += st->io_done - r->current_time;
+    st->burst_left = job->bursts[++st->burst_index];
+    r->burst[idx] = st->burst_left;
+    r->stats.io_operations++;
+    r->stats.device_busy[dev] += length;
+    set_runnable(r, idx, 0);
+    wheel_insert(&r->io_wheel, idx, st->io_done);
+    SCHED_LOG(r, "Time %d: Process %s blocked on device %d for %d units (done at %d)\n\n",
+              r->current_time, job->name, dev, length, st->io_done);
+}
+
+// Memory a job not yet swapped in could get: free memory plus what
+// swapping out completed jobs would reclaim, minus what is promised
+static SCHED_INLINE int memory_obtainable(const SchedRun *r) {
+    return r->available_memory + r->victim_memory - r->reserved_memory;
+}
+
+static inline void wait_tree_update(SchedRun *r, int size) {
+    int pos = r->wait_leaves + size;
+
+    r->wait_tree[pos] = r->wait_head[size] >= 0 ? r->wait_order[r->wait_head[size]] : NO_WAIT;
+    for (pos /= 2; pos >= 1; pos /= 2) {
+        long long left = r->wait_tree[2 * pos], right = r->wait_tree[2 * pos + 1];
+        r->wait_tree[pos] = left < right ? left : right;
+    }
+}
+
+static inline void wait_push(SchedRun *r, int idx) {
+    int size = r->jobs[idx].memory_required;
+
+    r->wait_order[idx] = r->next_wait++;
+    r->wait_next[idx] = -1;
+    if (r->wait_head[size] < 0) {
+        r->wait_head[size] = idx;
+        wait_tree_update(r, size);
+    } else {
+        r->wait_next[r->wait_tail[size]] = idx;
+    }
+    r->wait_tail[size] = idx;
+    r->n_waiting++;
+}
+
+// Remove the longest-waiting job of a size
+static inline int wait_pop(SchedRun *r, int size) {
+    int idx = r->wait_head[size];
+
+    r->wait_head[size] = r->wait_next[idx];
+    wait_tree_update(r, size);
+    r->n_waiting--;
+    return idx;
+}
+
+// Size of the longest-waiting job needing at most `limit` MB, -1 if none
+static inline int wait_first_fit(const SchedRun *r, int limit) {
+    int lo = r->wait_leaves, hi, node = 0;
+
+    if (limit < 0) return -1;
+    if (limit >= r->wait_leaves) limit = r->wait_leaves - 1;
+    // The node covering part of [0, limit] with the smallest wait number
+    for (hi = r->wait_leaves + limit + 1; lo < hi; lo /= 2, hi /= 2) {
+        if (lo & 1) {
+            if (r->wait_tree[lo] < r->wait_tree[node]) node = lo;
+            lo++;
+        }
+        if (hi & 1) {
+            hi--;
+            if (r->wait_tree[hi] < r->wait_tree[node]) node = hi;
+        }
+    }
+    if (r->wait_tree[node] == NO_WAIT) return -1;
+    // All of that node lies within the limit and wait numbers are unique,
+    // so one path leads down to the leaf holding it
+    while (node < r->wait_leaves) {
+        node = r->wait_tree[2 * node] == r->wait_tree[node] ? 2 * node : 2 * node + 1;
+    }
+    return node - r->wait_leaves;
+}
+
+// Largest size of at most `limit` MB with a waiting job, within the
+// node's range [lo, hi); -1 if none
+static inline int wait_best_fit(const SchedRun *r, int node, int lo, int hi, int limit) {
+    int mid = (lo + hi) / 2, found;
+
+    if (lo > limit || r->wait_tree[node] == NO_WAIT) return -1;
+    if (hi - lo == 1) return lo;
+    found = wait_best_fit(r, 2 * node + 1, mid, hi, limit);
+    return found >= 0 ? found : wait_best_fit(r, 2 * node, lo, mid, limit);
+}
+
+static SCHED_INLINE void memory_release(SchedRun *r, const Policy *p, int idx) {
+    JobState *st = &r->state[idx];
+    int waited = r->current_time - st->wait_since;
+
+    st->reserved = 1;
+    st->memory_stall += waited;
+    r->reserved_memory += r->jobs[idx].memory_required;
+    r->stats.memory_stall += waited;
+    SCHED_LOG(r, "Time %d: Process %s admitted to memory after waiting %d units\n",
+              r->current_time, r->jobs[idx].name, waited);
+    set_runnable(r, idx, 1);
+    enqueue_job(r, p, idx);
+}
+
+// Hand freed memory to waiting jobs according to the packing rule.  Each
+// release is O(log total_memory): fifo takes the longest waiter if it
+// fits, first-fit the longest waiter that fits, best-fit the longest
+// waiter of the largest size that fits.
+static SCHED_INLINE void release_waiting(SchedRun *r, const Policy *p) {
+    while (r->n_waiting > 0) {
+        int limit = memory_obtainable(r), size;
+
+        if (r->packing == PACK_FIFO) {
+            size = wait_first_fit(r, r->total_memory);
+            if (size > limit) break;
+        } else if (r->packing == PACK_BEST_FIT) {
+            size = wait_best_fit(r, 1, 0, r->wait_leaves, limit);
+        } else {
+            size = wait_first_fit(r, limit);
+        }
+        if (size < 0) break;
+        memory_release(r, p, wait_pop(r, size));
+    }
+}
+
+// A job about to be swapped in for the first time must fit in memory;
+// otherwise it joins the wait queue and the CPU goes to someone else.
+// Jobs larger than all of memory can never run and are rejected.
+static SCHED_INLINE int memory_admit(SchedRun *r, int idx) {
+    const Job *job = &r->jobs[idx];
+    JobState *st = &r->state[idx];
+
+    if (st->reserved) return 1;
+    if (job->memory_required > r->total_memory) {
+        SCHED_LOG(r, "Time %d: Rejected process %s (needs %d MB, only %d MB installed)\n",
+                  r->current_time, job->name, job->memory_required, r->total_memory);
+        reject_job(r, idx);
+        return 0;
+    }
+    if ((r->packing == PACK_FIFO && r->n_waiting > 0) ||
+        job->memory_required > memory_obtainable(r)) {
+        st->wait_since = r->current_time;
+        set_runnable(r, idx, 0);
+        wait_push(r, idx);
+        r->stats.memory_waits++;
+        SCHED_LOG(r, "Time %d: Process %s waits for memory (needs %d MB, %d MB obtainable)\n",
+                  r->current_time, job->name, job->memory_required, memory_obtainable(r));
+        return 0;
+    }
+    return 1;
+}
+
+// First dispatch of a job: free memory by swapping out completed jobs in
+// the policy's victim order, then swap the job in
+static SCHED_INLINE void swap_in(SchedRun *r, int idx) {
+    const Job *job = &r->jobs[idx];
+    JobState *st = &r->state[idx];
+
+    if (job->memory_required > r->available_memory) {
+        PROF_ENTER(r, PROF_VICTIMS);
+        SCHED_LOG(r, "Time %d: Process %s needs %d MB but only %d MB available\n",
+                  r->current_time, job->name, job->memory_required, r->available_memory);
+
+        while (r->n_victims > 0 && r->available_memory < job->memory_required) {
+            int j = heap_pop(r->victims, &r->n_victims, r->victim_key);
+            r->state[j].is_swapped = 1;
+            r->available_memory += r->jobs[j].memory_required;
+            r->victim_memory -= r->jobs[j].memory_required;
+            r->current_time += SWAP_TIME;
+            r->stats.swap_operations++;
+            SCHED_LOG(r, "Time %d: Swapped OUT process %s (freed %d MB, available: %d MB)\n",
+                      r->current_time, r->jobs[j].name, r->jobs[j].memory_required,
+                      r->available_memory);
+            if (r->stream) {
+                r->totals.swapped++;
+                release_slot(r, j);
+            }
+        }
+        PROF_LEAVE(r);
+    }
+
+    if (st->reserved) r->reserved_memory -= job->memory_required;
+    r->current_time += SWAP_TIME;
+    st->total_swap_time += SWAP_TIME;
+    r->available_memory -= job->memory_required;
+    r->stats.swap_operations++;
+
+    SCHED_LOG(r, "Time %d: Swapped IN process %s (required: %d MB, available: %d MB)\n",
+              r->current_time, job->name, job->memory_required, r->available_memory);
+}
+
+static SCHED_INLINE void run_policy(SchedRun *r, const Policy *p) {
+    SCHED_LOG(r, "\n\nScheduling Execution Log (%s", p->mode);
+    if (p->preemptive && (p->slice == slice_quantum || p->slice == slice_stride)) SCHED_LOG(r, " - TQ=%d", r->quantum);
+    SCHED_LOG(r, "):\n");
+    SCHED_LOG(r, "=================================\n");
+    SCHED_LOG(r, "Total Available Memory: %d MB\n\n", r->total_memory);
+
+    // Slot numbers mean nothing when streaming; arrival order stands in
+    // for job order there
+    r->victim_key = p->victims == VICTIMS_BY_ARRIVAL || r->stream ? r->arrival_rank : NULL;
+    r->stats.n_devices = r->n_devices;
+    if (p->init) p->init(r);
+    PROF_START(r);
+    admit_arrivals(r, p);
+
+    while (sched_running(r)) {
+        PROF_ENTER(r, PROF_SELECT);
+        int idx = p->select(r);
+        PROF_LEAVE(r);
+
+        // CPU idle: jump to the next arrival or I/O completion
+        if (idx == -1) {
+            r->current_time = next_event_time(r);
+            admit_arrivals(r, p);
+            continue;
+        }
+
+        const Job *job = &r->jobs[idx];
+        JobState *st = &r->state[idx];
+
+        if (!st->started) {
+            int admitted;
+
+            PROF_ENTER(r, PROF_MEMORY);
+            admitted = memory_admit(r, idx);
+            PROF_LEAVE(r);
+            if (!admitted) continue;
+        }
+
+        // Switching the CPU to another job (not the first dispatch, and
+        // not a job continuing straight after its own slice)
+        if (r->last_job != -1 && r->last_job != idx) {
+            r->stats.context_switches++;
+            if (r->switch_cost > 0) {
+                r->current_time += r->switch_cost;
+                r->stats.switch_overhead += r->switch_cost;
+                SCHED_LOG(r, "Time %d: Context switch %s -> %s (+%d units)\n", r->current_time,
+                          r->jobs[r->last_job].name, job->name, r->switch_cost);
+            }
+        }
+
+        if (!st->started) {
+            swap_in(r, idx);
+            st->start_time = r->current_time;
+            st->response_time = st->start_time - job->arrival_time;
+            st->started = 1;
+        }
+
+        int run = p->slice(r, idx);
+        if (run > st->burst_left) run = st->burst_left;
+
+        // A job resuming after another one ran pays the cold-cache penalty
+        if (r->last_job != idx && st->started_slices > 0 && r->cache_penalty > 0) {
+            r->current_time += r->cache_penalty;
+            r->stats.cache_overhead += r->cache_penalty;
+            SCHED_LOG(r, "Time %d: Process %s reloaded its working set (+%d units)\n",
+                      r->current_time, job->name, r->cache_penalty);
+        }
+        r->last_job = idx;
+        st->started_slices++;
+
+        if (p->preemptive) {
+            SCHED_LOG(r, "Time %d: Executing process %s (remaining: %d, quantum: %d)%s\n",
+                      r->current_time, job->name, st->remaining_time, run, p->tag);
+        } else {
+            SCHED_LOG(r, "Time %d: Executing process %s (burst: %d units)%s\n",
+                      r->current_time, job->name, run, p->tag);
+        }
+
+        // A job kept on the CPU across an arrival extends its slice
+        if (p->preempted && r->n_slices > 0 && r->slices[r->n_slices - 1].job == idx &&
+            r->slices[r->n_slices - 1].end == r->current_time) {
+            r->slices[r->n_slices - 1].end += run;
+        } else {
+            record_slice(r, idx, r->current_time, r->current_time + run);
+        }
+        st->remaining_time -= run;
+        st->burst_left -= run;
+        r->current_time += run;
+        account_share(r, idx, run);
+        if (st->burst_left == 0 && r->estimators) observe_burst(r, idx);
+
+        // Arrivals during the slice queue up ahead of the preempted job.
+        // A streamed arrival may grow the slot arrays.
+        admit_arrivals(r, p);
+        job = &r->jobs[idx];
+        st = &r->state[idx];
+
+        if (st->remaining_time > 0 && st->burst_left == 0) {
+            start_io(r, idx);
+        } else if (st->remaining_time > 0) {
+            enqueue_job(r, p, idx);
+            if (!p->preempted || p->preempted(r, idx)) {
+                r->stats.preemptions++;
+                SCHED_LOG(r, "Time %d: Process %s preempted (remaining: %d)\n\n",
+                          r->current_time, job->name, st->remaining_time);
+            }
+        } else {
+            st->completion_time = r->current_time;
+            st->turnaround_time = st->completion_time - job->arrival_time;
+            st->waiting_time = st->turnaround_time - job->burst_time - st->blocked_time;
+            st->is_completed = 1;
+            set_runnable(r, idx, 0);
+            r->completed++;
+            SCHED_LOG(r, "Time %d: Process %s completed\n\n", r->current_time, job->name);
+            if (r->stream) retire_job(r, idx);
+            // A completed job keeps its memory until swapped out; a streamed
+            // job holding none has nothing left to do with its slot
+            if (r->stream && job->memory_required == 0) {
+                release_slot(r, idx);
+            } else {
+                heap_push(r->victims, &r->n_victims, r->victim_key, idx);
+                r->victim_memory += job->memory_required;
+            }
+            if (r->dag) release_successors(r, p, idx);
+            if (r->n_waiting > 0) {
+                PROF_ENTER(r, PROF_MEMORY);
+                release_waiting(r, p);
+                PROF_LEAVE(r);
+            }
+        }
+    }
+
+    SCHED_LOG(r, "Total Swap Operations: %d\n", r->stats.swap_operations);
+    SCHED_LOG(r, "Total Swap Overhead: %d time units\n", r->stats.swap_operations * SWAP_TIME);
+    PROF_STOP(r);
+}
+
+static void calculate_fcfs(SchedRun *r) { run_policy(r, &FCFS_POLICY); }
+static void calculate_sjf(SchedRun *r) { run_policy(r, &SJF_POLICY); }
+static void calculate_rr(SchedRun *r) { run_policy(r, &RR_POLICY); }
+static void calculate_rr_adaptive(SchedRun *r) { run_policy(r, &RR_ADAPTIVE_POLICY); }
+static void calculate_priority(SchedRun *r) { run_policy(r, &PRIORITY_POLICY); }
+static void calculate_edf(SchedRun *r) { run_policy(r, &EDF_POLICY); }
+static void calculate_cpath(SchedRun *r) { run_policy(r, &CPATH_POLICY); }
+static void calculate_fair(SchedRun *r) { run_policy(r, &FAIR_POLICY); }
+static void calculate_psjf(SchedRun *r) { run_policy(r, &PSJF_POLICY); }
+static void calculate_lottery(SchedRun *r) { run_policy(r, &LOTTERY_POLICY); }
+static void calculate_stride(SchedRun *r) { run_policy(r, &STRIDE_POLICY); }
+
+typedef struct {
+    const Policy *policy;
+    void (*run)(SchedRun *r);
+} Scheduler;
+
+static const Scheduler SCHEDULERS[] = {
+    {&FCFS_POLICY, calculate_fcfs},
+    {&SJF_POLICY, calculate_sjf},
+    {&RR_POLICY, calculate_rr},
+    {&RR_ADAPTIVE_POLICY, calculate_rr_adaptive},
+    {&PRIORITY_POLICY, calculate_priority},
+    {&EDF_POLICY, calculate_edf},
+    {&CPATH_POLICY, calculate_cpath},
+    {&FAIR_POLICY, calculate_fair},
+    {&PSJF_POLICY, calculate_psjf},
+    {&LOTTERY_POLICY, calculate_lottery},
+    {&STRIDE_POLICY, calculate_stride},
+};
+
+#define NUM_SCHEDULERS ((int)(sizeof(SCHEDULERS) / sizeof(SCHEDULERS[0])))
+
+static inline const Scheduler *find_scheduler(const char *name) {
+    for (int i = 0; i < NUM_SCHEDULERS; i++) {
+        if (strcmp(SCHEDULERS[i].policy->name, name) == 0) return &SCHEDULERS[i];
+    }
+    return NULL;
+}
+
+#endif
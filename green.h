@@ -0,0 +1,235 @@
+#ifndef GREEN_H
+#define GREEN_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #error "green.h needs POSIX ucontext"
+#endif
+#include <ucontext.h>
+
+#define GREEN_STACK_SIZE (64 * 1024)
+
+// ─────────────────────────────────────────────────────────
+// Green-thread runtime
+//
+// Runs real task functions as user-space coroutines (ucontext) on one OS
+// thread, and picks the next one to run with the same rules as the
+// simulated schedulers.  Every task carries the workload metadata: type,
+// priority and an estimated burst.
+//
+//   FCFS      spawn order, a task runs until it finishes
+//   SJF       smallest estimate first (ties: spawn order)
+//   RR        spawn order; every green_yield() is one tick and a task
+//             goes to the back of the queue after `quantum` ticks
+//   PRIORITY  lowest priority number, then smallest estimate
+//
+// green_yield() is the only scheduling point.  When the calling task is
+// still the best choice it returns without switching.
+// ─────────────────────────────────────────────────────────
+
+typedef enum {
+    GREEN_FCFS,
+    GREEN_SJF,
+    GREEN_RR,
+    GREEN_PRIORITY
+} GreenPolicy;
+
+typedef void (*GreenFn)(void *arg);
+
+typedef struct GreenTask {
+    ucontext_t ctx;
+    GreenFn fn;
+    void *arg;
+    char type[50];
+    int priority;
+    int estimate;
+    int id;
+    int ticks;                     // yields in the current quantum
+    long long seq;                 // queue position; refreshed on RR requeue
+    char *stack;
+    struct GreenTask *next_free;
+} GreenTask;
+
+typedef struct {
+    GreenPolicy policy;
+    int quantum;
+    ucontext_t main_ctx;
+    GreenTask *current;
+    GreenTask **heap;              // ready tasks, best first
+    int n_ready;
+    int cap_ready;
+    GreenTask *free_tasks;         // finished tasks kept for their stacks
+    long long next_seq;
+    int next_id;
+    long long switches;
+    long long yields;
+    long long completed;
+} GreenRuntime;
+
+static GreenRuntime *green_active;
+
+static inline int green_before(const GreenRuntime *rt, const GreenTask *a, const GreenTask *b) {
+    switch (rt->policy) {
+    case GREEN_SJF:
+        if (a->estimate != b->estimate) return a->estimate < b->estimate;
+        break;
+    case GREEN_PRIORITY:
+        if (a->priority != b->priority) return a->priority < b->priority;
+        if (a->estimate != b->estimate) return a->estimate < b->estimate;
+        break;
+    default:
+        break;
+    }
+    return a->seq < b->seq;
+}
+
+static inline void green_push(GreenRuntime *rt, GreenTask *t) {
+    int pos;
+
+    if (rt->n_ready == rt->cap_ready) {
+        rt->cap_ready = rt->cap_ready ? rt->cap_ready * 2 : 64;
+        rt->heap = realloc(rt->heap, sizeof(GreenTask *) * rt->cap_ready);
+    }
+    pos = rt->n_ready++;
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (!green_before(rt, t, rt->heap[parent])) break;
+        rt->heap[pos] = rt->heap[parent];
+        pos = parent;
+    }
+    rt->heap[pos] = t;
+}
+
+static inline GreenTask *green_pop(GreenRuntime *rt) {
+    GreenTask *top, *last;
+    int pos = 0;
+
+    if (rt->n_ready == 0) return NULL;
+    top = rt->heap[0];
+    last = rt->heap[--rt->n_ready];
+    for (;;) {
+        int child = 2 * pos + 1;
+        if (child >= rt->n_ready) break;
+        if (child + 1 < rt->n_ready && green_before(rt, rt->heap[child + 1], rt->heap[child])) child++;
+        if (!green_before(rt, rt->heap[child], last)) break;
+        rt->heap[pos] = rt->heap[child];
+        pos = child;
+    }
+    if (rt->n_ready > 0) rt->heap[pos] = last;
+    return top;
+}
+
+static inline void green_init(GreenRuntime *rt, GreenPolicy policy, int quantum) {
+    memset(rt, 0, sizeof(*rt));
+    rt->policy = policy;
+    rt->quantum = quantum > 0 ? quantum : 1;
+}
+
+static void green_trampoline(void) {
+    GreenRuntime *rt = green_active;
+    GreenTask *t = rt->current;
+
+    t->fn(t->arg);
+    // Returning switches to uc_link, i.e. back into green_run()
+}
+
+// Kept out of line: getcontext() returns twice, like setjmp()
+static void green_make_context(GreenRuntime *rt, GreenTask *t) {
+    getcontext(&t->ctx);
+    t->ctx.uc_stack.ss_sp = t->stack;
+    t->ctx.uc_stack.ss_size = GREEN_STACK_SIZE;
+    t->ctx.uc_link = &rt->main_ctx;
+    makecontext(&t->ctx, green_trampoline, 0);
+}
+
+static inline GreenTask *green_spawn(GreenRuntime *rt, GreenFn fn, void *arg,
+                                     const char *type, int priority, int estimate) {
+    GreenTask *t = rt->free_tasks;
+
+    if (t) {
+        rt->free_tasks = t->next_free;
+    } else {
+        t = calloc(1, sizeof(GreenTask));
+        t->stack = malloc(GREEN_STACK_SIZE);
+    }
+    t->fn = fn;
+    t->arg = arg;
+    strncpy(t->type, type, sizeof(t->type) - 1);
+    t->type[sizeof(t->type) - 1] = '\0';
+    t->priority = priority;
+    t->estimate = estimate;
+    t->id = rt->next_id++;
+    t->ticks = 0;
+    t->seq = rt->next_seq++;
+
+    green_make_context(rt, t);
+    green_push(rt, t);
+    return t;
+}
+
+// Scheduling point for the running task
+static inline void green_yield(GreenRuntime *rt) {
+    GreenTask *cur = rt->current, *next;
+
+    rt->yields++;
+    if (rt->n_ready == 0) return;
+
+    if (rt->policy == GREEN_RR) {
+        if (++cur->ticks < rt->quantum) return;
+        cur->ticks = 0;
+        cur->seq = rt->next_seq++;
+    } else if (!green_before(rt, rt->heap[0], cur)) {
+        return;
+    }
+
+    green_push(rt, cur);
+    next = green_pop(rt);
+    if (next == cur) return;
+
+    rt->current = next;
+    rt->switches++;
+    swapcontext(&cur->ctx, &next->ctx);
+}
+
+// Run until every spawned task (including ones spawned by tasks) is done
+static inline void green_run(GreenRuntime *rt) {
+    GreenRuntime *outer = green_active;
+    GreenTask *t;
+
+    green_active = rt;
+    while ((t = green_pop(rt)) != NULL) {
+        rt->current = t;
+        rt->switches++;
+        swapcontext(&rt->main_ctx, &t->ctx);
+
+        // Back here only when the running task returned
+        t = rt->current;
+        t->next_free = rt->free_tasks;
+        rt->free_tasks = t;
+        rt->current = NULL;
+        rt->completed++;
+    }
+    green_active = outer;
+}
+
+static inline void green_destroy(GreenRuntime *rt) {
+    GreenTask *t = rt->free_tasks;
+
+    while (t) {
+        GreenTask *next = t->next_free;
+        free(t->stack);
+        free(t);
+        t = next;
+    }
+    for (int i = 0; i < rt->n_ready; i++) {
+        free(rt->heap[i]->stack);
+        free(rt->heap[i]);
+    }
+    free(rt->heap);
+    memset(rt, 0, sizeof(*rt));
+}
+
+#endif
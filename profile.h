@@ -0,0 +1,342 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <time.h>
+#include "scheduler.h"
+
+// ─────────────────────────────────────────────────────────
+// Hot-path profiler
+//
+// Built only with -DSCHED_PROFILE.  Without it every PROF_ macro expands
+// to nothing and the engine compiles exactly as it did before.
+//
+// The event loop is split into phases.  PROF_ENTER(r, phase) charges the
+// ticks since the last transition to the phase being left and makes
+// `phase` current until the matching PROF_LEAVE(r).  Nested phases (a log
+// line printed during a swap-out) are charged once, to the innermost one,
+// so the phase times add up to the whole run.  Ticks are TSC cycles on
+// x86 and nanoseconds elsewhere; the report converts them to time with
+// the wall clock measured across the run.
+//
+// On Linux, cache-miss and branch-miss counters are opened with
+// perf_event_open, counting this thread in user space only.  When the
+// kernel lets user space read them with rdpmc, they are split per phase
+// like the ticks.  Otherwise only whole-run totals are reported.  If they
+// cannot be opened at all (no PMU in a VM, perf_event_paranoid), the
+// report says why and shows ticks alone.
+// ─────────────────────────────────────────────────────────
+
+typedef enum {
+    PROF_OTHER,                    // the loop itself: dispatch, accounting, completion
+    PROF_SELECT,                   // policy select hook
+    PROF_ENQUEUE,                  // policy enqueue hook
+    PROF_ARRIVALS,                 // polling arrivals and I/O completions
+    PROF_VICTIMS,                  // swap-out victim search
+    PROF_MEMORY,                   // memory wait queue
+    PROF_LOG,                      // execution log output
+    PROF_PHASES
+} ProfPhase;
+
+#ifdef SCHED_PROFILE
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define PROF_HAVE_TSC 1
+    #include <x86intrin.h>
+#endif
+
+#ifdef __linux__
+    #include <errno.h>
+    #include <unistd.h>
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+#endif
+
+#define PROF_COUNTERS 2
+#define PROF_MAX_DEPTH 8
+
+typedef enum {
+    PROF_COUNTERS_NONE,
+    PROF_COUNTERS_TOTAL,           // read() at start and stop
+    PROF_COUNTERS_PER_PHASE        // rdpmc at every transition
+} ProfCounterMode;
+
+static const char *const PROF_PHASE_NAMES[PROF_PHASES] = {
+    "loop", "select", "enqueue", "arrivals", "victims", "memory", "log"
+};
+
+typedef struct {
+    int active;
+    int phase;                     // current phase
+    int depth;
+    int stack[PROF_MAX_DEPTH];     // phases to return to
+    unsigned long long since;      // ticks at the last transition
+    unsigned long long ticks[PROF_PHASES];
+    long long calls[PROF_PHASES];
+    unsigned long long start_ticks;
+    unsigned long long total_ticks;
+    double start_wall;
+    double wall;                   // seconds across the run
+
+    int counter_mode;              // ProfCounterMode
+    char counter_error[128];
+    unsigned long long counter_since[PROF_COUNTERS];
+    unsigned long long events[PROF_PHASES][PROF_COUNTERS];
+    unsigned long long event_total[PROF_COUNTERS];
+#ifdef __linux__
+    int fd[PROF_COUNTERS];
+    struct perf_event_mmap_page *page[PROF_COUNTERS];
+#endif
+} Profile;
+
+static const char *const PROF_COUNTER_NAMES[PROF_COUNTERS] = {"cache misses", "branch misses"};
+
+static inline unsigned long long prof_ticks(void) {
+#ifdef PROF_HAVE_TSC
+    return __rdtsc();
+#elif defined(_WIN32)
+    LARGE_INTEGER t;
+    QueryPerformanceCounter(&t);
+    return (unsigned long long)t.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (unsigned long long)t.tv_sec * 1000000000ULL + (unsigned long long)t.tv_nsec;
+#endif
+}
+
+#ifdef __linux__
+
+// Counter value through the mmap page: the kernel's running offset plus
+// the live hardware counter, retried if the kernel updated the page
+// meanwhile
+static inline unsigned long long prof_rdpmc(const volatile struct perf_event_mmap_page *pc) {
+    unsigned long long count = 0;
+#ifdef PROF_HAVE_TSC
+    unsigned int seq;
+
+    do {
+        unsigned int idx;
+
+        seq = pc->lock;
+        __asm__ volatile("" ::: "memory");
+        idx = pc->index;
+        count = (unsigned long long)pc->offset;
+        if (pc->cap_user_rdpmc && idx) {
+            unsigned int lo, hi, shift = 64 - pc->pmc_width;
+            long long pmc;
+
+            __asm__ volatile("rdpmc" : "=a"(lo), "=d"(hi) : "c"(idx - 1));
+            pmc = (long long)(((unsigned long long)hi << 32) | lo);
+            count += (unsigned long long)((long long)((unsigned long long)pmc << shift) >> shift);
+        }
+        __asm__ volatile("" ::: "memory");
+    } while (pc->lock != seq);
+#else
+    (void)pc;
+#endif
+    return count;
+}
+
+static inline void prof_open_counters(Profile *p) {
+    static const unsigned long long config[PROF_COUNTERS] = {
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    long page_size = sysconf(_SC_PAGESIZE);
+    int opened = 0, per_phase = 1;
+
+    for (int k = 0; k < PROF_COUNTERS; k++) {
+        struct perf_event_attr attr;
+
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config[k];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        p->page[k] = NULL;
+        p->fd[k] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        if (p->fd[k] < 0) {
+            if (!p->counter_error[0]) {
+                snprintf(p->counter_error, sizeof(p->counter_error), "%s: %s",
+                         PROF_COUNTER_NAMES[k], strerror(errno));
+            }
+            per_phase = 0;
+            continue;
+        }
+        opened++;
+        p->page[k] = mmap(NULL, (size_t)page_size, PROT_READ, MAP_SHARED, p->fd[k], 0);
+        if (p->page[k] == MAP_FAILED) p->page[k] = NULL;
+        ioctl(p->fd[k], PERF_EVENT_IOC_RESET, 0);
+        ioctl(p->fd[k], PERF_EVENT_IOC_ENABLE, 0);
+    }
+    if (opened == 0) return;
+
+    // rdpmc needs x86 and the kernel's permission, which it only reports
+    // once a counter is live
+#ifdef PROF_HAVE_TSC
+    for (int k = 0; k < PROF_COUNTERS; k++) {
+        if (p->fd[k] >= 0 && (!p->page[k] || !p->page[k]->cap_user_rdpmc)) per_phase = 0;
+    }
+#else
+    per_phase = 0;
+#endif
+    p->counter_mode = per_phase ? PROF_COUNTERS_PER_PHASE : PROF_COUNTERS_TOTAL;
+}
+
+static inline unsigned long long prof_read_counter(const Profile *p, int k) {
+    unsigned long long value = 0;
+
+    if (p->fd[k] < 0) return 0;
+    if (p->counter_mode == PROF_COUNTERS_PER_PHASE) return prof_rdpmc(p->page[k]);
+    if (read(p->fd[k], &value, sizeof(value)) != (ssize_t)sizeof(value)) return 0;
+    return value;
+}
+
+static inline void prof_close_counters(Profile *p) {
+    long page_size = sysconf(_SC_PAGESIZE);
+
+    for (int k = 0; k < PROF_COUNTERS; k++) {
+        if (p->fd[k] < 0) continue;
+        ioctl(p->fd[k], PERF_EVENT_IOC_DISABLE, 0);
+        if (p->page[k]) munmap(p->page[k], (size_t)page_size);
+        close(p->fd[k]);
+        p->fd[k] = -1;
+    }
+}
+
+#else
+
+static inline void prof_open_counters(Profile *p) {
+    snprintf(p->counter_error, sizeof(p->counter_error), "perf_event_open needs Linux");
+}
+
+static inline unsigned long long prof_read_counter(const Profile *p, int k) {
+    (void)p;
+    (void)k;
+    return 0;
+}
+
+static inline void prof_close_counters(Profile *p) {
+    (void)p;
+}
+
+#endif
+
+// Charge the ticks (and counter events) since the last transition to the
+// current phase
+static inline void prof_charge(Profile *p) {
+    unsigned long long now = prof_ticks();
+
+    p->ticks[p->phase] += now - p->since;
+    p->since = now;
+    if (p->counter_mode == PROF_COUNTERS_PER_PHASE) {
+        for (int k = 0; k < PROF_COUNTERS; k++) {
+            unsigned long long value = prof_read_counter(p, k);
+            p->events[p->phase][k] += value - p->counter_since[k];
+            p->counter_since[k] = value;
+        }
+    }
+}
+
+static inline void prof_start(Profile *p) {
+    memset(p, 0, sizeof(*p));
+    prof_open_counters(p);
+    for (int k = 0; k < PROF_COUNTERS; k++) p->counter_since[k] = prof_read_counter(p, k);
+    p->phase = PROF_OTHER;
+    p->active = 1;
+    p->start_wall = get_time();
+    p->start_ticks = p->since = prof_ticks();
+}
+
+static inline void prof_enter(Profile *p, int phase) {
+    if (!p->active) return;
+    prof_charge(p);
+    if (p->depth < PROF_MAX_DEPTH) p->stack[p->depth] = p->phase;
+    p->depth++;
+    p->phase = phase;
+    p->calls[phase]++;
+}
+
+static inline void prof_leave(Profile *p) {
+    if (!p->active) return;
+    prof_charge(p);
+    p->depth--;
+    p->phase = p->depth < PROF_MAX_DEPTH ? p->stack[p->depth] : PROF_OTHER;
+}
+
+static inline void prof_stop(Profile *p) {
+    if (!p->active) return;
+    prof_charge(p);
+    p->total_ticks = p->since - p->start_ticks;
+    p->wall = get_time() - p->start_wall;
+    for (int k = 0; k < PROF_COUNTERS; k++) {
+        p->event_total[k] = prof_read_counter(p, k) - p->counter_since[k];
+        if (p->counter_mode == PROF_COUNTERS_PER_PHASE) {
+            p->event_total[k] = 0;
+            for (int ph = 0; ph < PROF_PHASES; ph++) p->event_total[k] += p->events[ph][k];
+        }
+    }
+    prof_close_counters(p);
+    p->active = 0;
+}
+
+static inline void prof_report(const Profile *p, const char *policy) {
+    double ms_per_tick = p->total_ticks > 0 ? p->wall * 1000 / p->total_ticks : 0;
+    int counters = p->counter_mode != PROF_COUNTERS_NONE;
+
+    printf("\nHot-Path Profile (%s):\n", policy);
+    printf("=====================================================================================\n");
+    printf("Phase      Calls        Ticks/call   Time (ms)   Share%s\n",
+           counters ? "     Cache miss   Branch miss" : "");
+    printf("=====================================================================================\n");
+    for (int ph = 0; ph < PROF_PHASES; ph++) {
+        double share = p->total_ticks > 0 ? (double)p->ticks[ph] / p->total_ticks * 100 : 0;
+
+        printf("%-10s ", PROF_PHASE_NAMES[ph]);
+        if (ph == PROF_OTHER) printf("%-12s %-12s ", "-", "-");
+        else if (p->calls[ph] == 0) printf("%-12d %-12s ", 0, "-");
+        else printf("%-12lld %-12.1f ", p->calls[ph], (double)p->ticks[ph] / p->calls[ph]);
+        printf("%-11.3f %.2f%%", p->ticks[ph] * ms_per_tick, share);
+        if (p->counter_mode == PROF_COUNTERS_PER_PHASE) {
+            printf("%*s%-12llu %llu", share < 10 ? 5 : 4, "", p->events[ph][0], p->events[ph][1]);
+        }
+        printf("\n");
+    }
+    printf("=====================================================================================\n");
+    printf("%-10s %-12s %-12s %-11.3f 100.00%%", "total", "", "", p->wall * 1000);
+    if (counters) printf("   %-12llu %llu", p->event_total[0], p->event_total[1]);
+    printf("\n");
+#ifdef PROF_HAVE_TSC
+    printf("Ticks are TSC cycles (%.2f GHz over this run)\n",
+           p->wall > 0 ? p->total_ticks / p->wall / 1e9 : 0.0);
+#else
+    printf("Ticks are nanoseconds\n");
+#endif
+    if (p->counter_mode == PROF_COUNTERS_TOTAL) {
+        printf("Hardware counters: whole-run totals only (rdpmc not permitted)\n");
+    }
+    if (p->counter_error[0]) {
+        printf("Hardware counters: %s%s\n", counters ? "" : "unavailable, ", p->counter_error);
+    }
+}
+
+#define PROF_START(r) prof_start(&(r)->prof)
+#define PROF_STOP(r) prof_stop(&(r)->prof)
+#define PROF_ENTER(r, phase) prof_enter(&(r)->prof, (phase))
+#define PROF_LEAVE(r) prof_leave(&(r)->prof)
+#define PROF_REPORT(r, policy) prof_report(&(r)->prof, (policy))
+
+#else
+
+#define PROF_START(r) ((void)0)
+#define PROF_STOP(r) ((void)0)
+#define PROF_ENTER(r, phase) ((void)0)
+#define PROF_LEAVE(r) ((void)0)
+#define PROF_REPORT(r, policy) ((void)0)
+
+#endif
+
+#endif
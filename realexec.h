@@ -0,0 +1,323 @@
+#ifndef REALEXEC_H
+#define REALEXEC_H
+
+#include "engine.h"
+
+#define REAL_UNIT_MS 20                // wall-clock milliseconds per time unit
+#define REAL_MAX_WORKERS 50            // one process per job; larger runs are refused
+
+// ─────────────────────────────────────────────────────────
+// Real-execution mode
+//
+// Runs the policy again on real processes and compares the outcome with
+// the simulation.  One CPU-bound worker is forked per job and burns
+// burst_time * unit_ms of its own CPU time.  The dispatcher pins itself
+// and the workers to one CPU and drives a second SchedRun with the same
+// policy hooks, but from measured time: arrivals and I/O completions are
+// admitted when the wall clock reaches them, the policy picks the next
+// worker, and a quantum ends once that worker has used the quantum's CPU
+// time (read from its CPU clock), not when the model says it would.
+// A job's final slice lasts until its worker exits.  Memory admission
+// follows the model; swap, switch and reload costs are slept through.
+// Timer slack, signal latency and the dispatcher's own overhead then show
+// up as the difference between measured and simulated times.
+// ─────────────────────────────────────────────────────────
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <sched.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+typedef struct {
+    pid_t pid;
+    clockid_t clock;               // the worker's CPU-time clock
+    int exited;                    // reaped
+    double first_run;              // ms since start, -1 until first SIGCONT
+    double completion;             // ms since start
+    double on_cpu;                 // ms between resuming and stopping it
+} RealJob;
+
+static inline double real_now_ms(const struct timespec *t0) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (t.tv_sec - t0->tv_sec) * 1000.0 + (t.tv_nsec - t0->tv_nsec) / 1e6;
+}
+
+static inline void real_sleep_ms(double ms) {
+    if (ms > 0) {
+        struct timespec ts;
+        ts.tv_sec = (time_t)(ms / 1000);
+        ts.tv_nsec = (long)((ms - ts.tv_sec * 1000.0) * 1e6);
+        while (nanosleep(&ts, &ts) == -1 && errno == EINTR) {}
+    }
+}
+
+static inline void real_sleep_until(const struct timespec *t0, double target_ms) {
+    real_sleep_ms(target_ms - real_now_ms(t0));
+}
+
+// Simulated time unit the wall clock is in
+static inline int real_units(const struct timespec *t0, int unit_ms) {
+    return (int)(real_now_ms(t0) / unit_ms);
+}
+
+// Worker body: stop until the dispatcher first resumes us, then burn
+// exactly cpu_ms of our own CPU time.  Time spent stopped is not counted.
+static inline void real_worker(double cpu_ms) {
+    struct timespec t;
+    double used;
+
+    raise(SIGSTOP);
+    do {
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &t);
+        used = t.tv_sec * 1000.0 + t.tv_nsec / 1e6;
+    } while (used < cpu_ms);
+    _exit(0);
+}
+
+// CPU time the worker has used so far, -1 once it can no longer be read
+static inline double real_cpu_ms(const RealJob *w) {
+    struct timespec t;
+
+    if (clock_gettime(w->clock, &t) != 0) return -1;
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1e6;
+}
+
+// Resume a stopped worker until it has used cpu_ms more CPU time, or with
+// cpu_ms < 0 until it exits, then stop it again.  Returns 1 if the worker
+// exited (its budget can run out before the quantum does); it has then
+// been reaped and must not be signalled again.
+static inline int real_run(RealJob *w, double cpu_ms) {
+    double target = real_cpu_ms(w) + cpu_ms;
+    int status;
+
+    kill(w->pid, SIGCONT);
+    if (cpu_ms < 0) {
+        waitpid(w->pid, &status, 0);
+        return w->exited = 1;
+    }
+    for (;;) {
+        double used;
+
+        if (waitpid(w->pid, &status, WNOHANG) == w->pid) return w->exited = 1;
+        used = real_cpu_ms(w);
+        if (used < 0 || used >= target) break;
+        real_sleep_ms(target - used);
+    }
+    kill(w->pid, SIGSTOP);
+    waitpid(w->pid, &status, WUNTRACED);
+    if (WIFEXITED(status) || WIFSIGNALED(status)) return w->exited = 1;
+    return 0;
+}
+
+static inline void real_kill_all(RealJob real[], int n) {
+    for (int i = 0; i < n; i++) {
+        int status;
+
+        if (real[i].pid <= 0 || real[i].exited) continue;
+        kill(real[i].pid, SIGKILL);
+        waitpid(real[i].pid, &status, 0);
+        real[i].exited = 1;
+    }
+}
+
+// model: the finished simulation.  live: the same jobs, configured the
+// same way but not run yet; the real dispatch runs on it.
+static inline int run_real_execution(const SchedRun *model, SchedRun *live, const Policy *p, int unit_ms) {
+    const Job *jobs = live->jobs;
+    RealJob *real = calloc(live->n, sizeof(RealJob));
+    struct timespec t0;
+    cpu_set_t cpus;
+    int cpu = sched_getcpu(), workers = 0, makespan_units = 0;
+    double makespan = 0;
+
+    // Pin everything to one CPU so the dispatcher's choice is the only one
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu < 0 ? 0 : cpu, &cpus);
+    if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+        perror("sched_setaffinity");
+    }
+
+    for (int i = 0; i < live->n; i++) {
+        int status;
+        pid_t pid;
+
+        if (jobs[i].memory_required > live->total_memory) continue;     // can never run
+        pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            real_kill_all(real, i);
+            free(real);
+            return -1;
+        }
+        if (pid == 0) real_worker((double)jobs[i].burst_time * unit_ms);
+
+        waitpid(pid, &status, WUNTRACED);
+        real[i].pid = pid;
+        real[i].first_run = -1;
+        workers++;
+        if (clock_getcpuclockid(pid, &real[i].clock) != 0) {
+            fprintf(stderr, "Cannot read the CPU clock of worker %d\n", (int)pid);
+            real_kill_all(real, i + 1);
+            free(real);
+            return -1;
+        }
+    }
+
+    printf("\n\nReal Execution Log (%d workers pinned to CPU %d, %d ms/unit):\n",
+           workers, cpu < 0 ? 0 : cpu, unit_ms);
+    printf("=================================\n");
+
+    live->verbose = 0;
+    live->victim_key = p->victims == VICTIMS_BY_ARRIVAL ? live->arrival_rank : NULL;
+    live->stats.n_devices = live->n_devices;
+    if (p->init) p->init(live);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    while (sched_running(live)) {
+        live->current_time = real_units(&t0, unit_ms);
+        admit_arrivals(live, p);
+
+        int idx = p->select(live);
+        if (idx == -1) {
+            int next = next_event_time(live);
+            if (next == INT_MAX) break;
+            real_sleep_until(&t0, (double)next * unit_ms);
+            continue;
+        }
+
+        const Job *job = &jobs[idx];
+        JobState *st = &live->state[idx];
+        int cost = 0, run, exited;
+        double began;
+
+        if (!st->started && !memory_admit(live, idx)) continue;
+
+        // Workers hold no real memory or cache, so the model's switch,
+        // swap and reload costs are paid as dispatcher sleeps
+        if (live->last_job != -1 && live->last_job != idx) {
+            live->stats.context_switches++;
+            cost += live->switch_cost;
+        }
+        if (!st->started) {
+            int before = live->current_time;
+
+            swap_in(live, idx);
+            cost += live->current_time - before;
+        } else if (live->last_job != idx && live->cache_penalty > 0) {
+            cost += live->cache_penalty;
+        }
+        real_sleep_ms((double)cost * unit_ms);
+        live->current_time = real_units(&t0, unit_ms);
+        if (!st->started) {
+            st->start_time = live->current_time;
+            st->response_time = st->start_time - job->arrival_time;
+            st->started = 1;
+        }
+
+        run = p->slice(live, idx);
+        if (run > st->burst_left) run = st->burst_left;
+        live->last_job = idx;
+        st->started_slices++;
+
+        // The final slice lasts until the worker exits, however long
+        // its CPU budget turns out to take
+        began = real_now_ms(&t0);
+        if (real[idx].first_run < 0) real[idx].first_run = began;
+        exited = real_run(&real[idx], run == st->remaining_time ? -1 : run * (double)unit_ms);
+        real[idx].on_cpu += real_now_ms(&t0) - began;
+
+        st->remaining_time -= run;
+        st->burst_left -= run;
+        // A worker that exits early has spent its whole budget; nothing
+        // of it is left to dispatch
+        if (exited) st->remaining_time = st->burst_left = 0;
+        live->current_time = real_units(&t0, unit_ms);
+        account_share(live, idx, run);
+        if (st->burst_left == 0 && live->estimators) observe_burst(live, idx);
+        admit_arrivals(live, p);
+
+        if (st->remaining_time > 0 && st->burst_left == 0) {
+            start_io(live, idx);
+        } else if (st->remaining_time > 0) {
+            enqueue_job(live, p, idx);
+        } else {
+            real[idx].completion = real_now_ms(&t0);
+            if (real[idx].completion > makespan) makespan = real[idx].completion;
+            printf("%9.1f ms: %s exited\n", real[idx].completion, job->name);
+            st->completion_time = live->current_time;
+            st->turnaround_time = st->completion_time - job->arrival_time;
+            st->is_completed = 1;
+            set_runnable(live, idx, 0);
+            live->completed++;
+            heap_push(live->victims, &live->n_victims, live->victim_key, idx);
+            live->victim_memory += job->memory_required;
+            if (live->dag) release_successors(live, p, idx);
+            if (live->n_waiting > 0) release_waiting(live, p);
+        }
+    }
+    real_kill_all(real, live->n);          // workers of jobs the live run rejected
+
+    double total_err_tat = 0, total_err_wt = 0, total_err_rt = 0, total_bias = 0;
+    int measured = 0, differ = 0;
+
+    printf("\n\nSimulated vs Measured (ms):\n");
+    printf("==========================================================================================\n");
+    printf("Name  Sim TAT   Real TAT  Sim WT    Real WT   Sim RT    Real RT   TAT Error\n");
+    printf("==========================================================================================\n");
+    for (int i = 0; i < live->n; i++) {
+        if (model->state[i].completion_time > makespan_units) makespan_units = model->state[i].completion_time;
+        if (model->state[i].rejected != live->state[i].rejected) differ++;
+        if (model->state[i].rejected || live->state[i].rejected) continue;
+        double arrival = jobs[i].arrival_time * (double)unit_ms;
+        double sim_tat = model->state[i].turnaround_time * (double)unit_ms;
+        double sim_wt = model->state[i].waiting_time * (double)unit_ms;
+        double sim_rt = model->state[i].response_time * (double)unit_ms;
+        double real_tat = real[i].completion - arrival;
+        double real_wt = real_tat - real[i].on_cpu - live->state[i].blocked_time * (double)unit_ms;
+        double real_rt = real[i].first_run - arrival;
+
+        measured++;
+        total_bias += real_tat - sim_tat;
+        total_err_tat += real_tat > sim_tat ? real_tat - sim_tat : sim_tat - real_tat;
+        total_err_wt += real_wt > sim_wt ? real_wt - sim_wt : sim_wt - real_wt;
+        total_err_rt += real_rt > sim_rt ? real_rt - sim_rt : sim_rt - real_rt;
+        printf("%-5s %-9.1f %-9.1f %-9.1f %-9.1f %-9.1f %-9.1f %+.1f%%\n", jobs[i].name,
+               sim_tat, real_tat, sim_wt, real_wt, sim_rt, real_rt,
+               sim_tat > 0 ? (real_tat - sim_tat) / sim_tat * 100 : 0.0);
+    }
+    printf("==========================================================================================\n");
+    if (measured > 0) {
+        printf("Mean Absolute Error (TAT)  : %.2f ms\n", total_err_tat / measured);
+        printf("Mean Absolute Error (WT)   : %.2f ms\n", total_err_wt / measured);
+        printf("Mean Absolute Error (RT)   : %.2f ms\n", total_err_rt / measured);
+        printf("Mean Error (TAT, bias)     : %+.2f ms\n", total_bias / measured);
+    } else {
+        printf("Mean Absolute Error        : - (every job was rejected)\n");
+    }
+    printf("Makespan                   : %.1f ms simulated, %.1f ms measured\n",
+           makespan_units * (double)unit_ms, makespan);
+    if (differ > 0) printf("Rejected in Only One Run   : %d jobs\n", differ);
+
+    free(real);
+    return 0;
+}
+
+#else
+
+static inline int run_real_execution(const SchedRun *model, SchedRun *live, const Policy *p, int unit_ms) {
+    (void)model;
+    (void)live;
+    (void)p;
+    (void)unit_ms;
+    fprintf(stderr, "Real-execution mode needs Linux (fork, SIGSTOP/SIGCONT, sched_setaffinity)\n");
+    return -1;
+}
+
+#endif
+
+#endif
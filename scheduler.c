@@ -0,0 +1,897 @@
+#define _GNU_SOURCE
+#include "engine.h"
+#include "realexec.h"
+#include "compare.h"
+
+#define TRACE_PRINT_LIMIT 50           // larger runs skip the log, table and Gantt chart
+
+#ifndef _WIN32
+    #include <sys/resource.h>
+#endif
+
+static void print_usage(const char *prog) {
+    fprintf(stderr, "Usage: %s <policy> [options]\n", prog);
+    fprintf(stderr, "       %s compare [--policies LIST] [options]\n", prog);
+    fprintf(stderr, "Policies:");
+    for (int i = 0; i < NUM_SCHEDULERS; i++) fprintf(stderr, " %s", SCHEDULERS[i].policy->name);
+    fprintf(stderr, "\nOptions:\n");
+    fprintf(stderr, "  -q, --quantum N     time quantum for rr, and the baseline rr-adaptive\n"
+                    "                      is compared against (default %d)\n", TIME_QUANTUM);
+    fprintf(stderr, "  --switch-cost N     time units lost per context switch (default %d)\n",
+            CONTEXT_SWITCH_COST);
+    fprintf(stderr, "  --cache-penalty N   extra time units when a preempted job resumes after\n"
+                    "                      another job has run (default %d)\n", CACHE_WARMTH_PENALTY);
+    fprintf(stderr, "  --real [MS]         run the policy again on real worker processes, MS\n"
+                    "                      milliseconds per time unit (default %d, Linux only,\n"
+                    "                      at most %d jobs)\n",
+            REAL_UNIT_MS, REAL_MAX_WORKERS);
+    fprintf(stderr, "  --trace FILE        load jobs from a CSV trace instead of the built-in\n"
+                    "                      workload (name,type,arrival,burst,priority,memory[,deadline])\n");
+    fprintf(stderr, "  --stream FILE       run a trace sorted by arrival without loading it:\n"
+                    "                      memory follows the jobs in flight (not edf, cpath\n"
+                    "                      or psjf, which need the whole trace)\n");
+    fprintf(stderr, "  --results FILE      with --stream, write one CSV row per finished job\n");
+    fprintf(stderr, "  --admission MODE    edf admission control: none, reject or defer\n"
+                    "                      (default defer)\n");
+    fprintf(stderr, "  --packing MODE      which jobs waiting for memory go first when memory\n"
+                    "                      frees: fifo, first-fit or best-fit (default first-fit)\n");
+    fprintf(stderr, "  --io-mix            built-in workload with I/O bursts in the web, API\n"
+                    "                      and database requests\n");
+    fprintf(stderr, "  --devices N         I/O devices serving blocked jobs (default 1, max %d)\n",
+            MAX_IO_DEVICES);
+    fprintf(stderr, "  --dag               built-in pipeline: P9 needs P1 and P5, P10 needs P3 and P5\n");
+    fprintf(stderr, "  --deps FILE         dependencies as pred,succ job numbers, one pair per line\n");
+    fprintf(stderr, "  --inner POLICY      order inside a fair-share group: fcfs, sjf, rr,\n"
+                    "                      priority or edf (default rr)\n");
+    fprintf(stderr, "  --weights LIST      group CPU weights, e.g. \"Web Request=4,Batch Analytics=1\"\n"
+                    "                      (defaults: web %d, API %d, database %d, others %d)\n",
+            SHARE_WEB, SHARE_API, SHARE_DATABASE, SHARE_OTHER);
+    fprintf(stderr, "  --predictor MODE    psjf burst estimate: ema, or a percentile such as p50\n"
+                    "                      or p90 of past bursts (default ema)\n");
+    fprintf(stderr, "  --alpha A           psjf: weight of the newest burst in the ema, 0 < A <= 1\n"
+                    "                      (default %.1f)\n", PREDICT_ALPHA);
+    fprintf(stderr, "  --predict-key KEY   psjf: jobs sharing an estimator: type or name\n"
+                    "                      (default type)\n");
+    fprintf(stderr, "  --tickets FROM      lottery/stride tickets from priority or type (group\n"
+                    "                      weight); with other policies, report the ticket share\n"
+                    "                      error too (default priority)\n");
+    fprintf(stderr, "  --seed N            lottery random seed (default %d)\n", LOTTERY_SEED);
+    fprintf(stderr, "  --policies LIST     compare: policies to run side by side, one thread\n"
+                    "                      each (default %s)\n", COMPARE_POLICIES);
+}
+
+// Options every run gets, whether one policy runs or several are compared
+typedef struct {
+    int quantum;
+    int switch_cost;
+    int cache_penalty;
+    int admission;
+    int packing;
+    int devices;
+    int inner;
+    const char *weights;
+    int predict_mode;
+    int predict_percentile;
+    int predict_key;
+    double alpha;
+    int tickets_by;
+    int tickets_given;
+    unsigned long long seed;
+} RunSettings;
+
+// "Name=W,Name=W": groups are the job types without any "(...)" qualifier
+static int apply_weights(SchedRun *r, const char *list) {
+    char buf[512], *item, *save;
+
+    snprintf(buf, sizeof(buf), "%s", list);
+    for (item = strtok_r(buf, ",", &save); item; item = strtok_r(NULL, ",", &save)) {
+        char *eq = strchr(item, '=');
+        int g, weight;
+
+        if (!eq || (weight = atoi(eq + 1)) < 1) {
+            fprintf(stderr, "Bad weight \"%s\": expected Group=N with N >= 1\n", item);
+            return -1;
+        }
+        *eq = '\0';
+        while (*item == ' ') item++;
+        // A streamed run has not seen its types yet: look in the trace, and
+        // name the group now if it is there
+        if (r->stream) g = trace_has_group(r->stream->path, item) ? sched_group(r, item) : r->n_groups;
+        else for (g = 0; g < r->n_groups; g++) {
+            if (strcmp(r->groups[g].name, item) == 0) break;
+        }
+        if (g == r->n_groups) {
+            fprintf(stderr, "No job type group named \"%s\"\n", item);
+            return -1;
+        }
+        r->groups[g].weight = weight;
+    }
+    return 0;
+}
+
+static int configure_run(SchedRun *r, const Scheduler *sched, const RunSettings *s, const Dag *dag) {
+    r->switch_cost = s->switch_cost;
+    r->cache_penalty = s->cache_penalty;
+    r->admission = s->admission;
+    r->packing = s->packing;
+    r->n_devices = s->devices;
+    if (dag->n > 0) sched_set_dag(r, dag);
+    r->inner = s->inner;
+    if (sched->policy->enqueue == enqueue_predicted) {
+        sched_set_predictor(r, s->predict_mode, s->predict_key, s->alpha, s->predict_percentile);
+    }
+    if (s->tickets_given || sched->policy->enqueue == enqueue_lottery ||
+        sched->policy->enqueue == enqueue_stride) {
+        sched_set_tickets(r, s->tickets_by, s->seed);
+    }
+    if (s->weights && apply_weights(r, s->weights) != 0) return -1;
+    return 0;
+}
+
+// "fcfs,sjf,...": each policy at most once
+static int parse_policies(const char *list, const Scheduler *picked[]) {
+    char buf[512], *item, *save;
+    int k = 0;
+
+    snprintf(buf, sizeof(buf), "%s", list);
+    for (item = strtok_r(buf, ",", &save); item; item = strtok_r(NULL, ",", &save)) {
+        const Scheduler *sched;
+
+        while (*item == ' ') item++;
+        if ((sched = find_scheduler(item)) == NULL) {
+            fprintf(stderr, "Unknown policy \"%s\"\n", item);
+            return -1;
+        }
+        for (int i = 0; i < k; i++) {
+            if (picked[i] == sched) {
+                fprintf(stderr, "Policy \"%s\" is listed twice\n", item);
+                return -1;
+            }
+        }
+        picked[k++] = sched;
+    }
+    if (k == 0) {
+        fprintf(stderr, "No policies to compare\n");
+        return -1;
+    }
+    return k;
+}
+
+// CPU each group received against what its weight entitled it to while it
+// had runnable work, and its latency percentiles
+static void print_group_report(const SchedRun *r) {
+    int *start = calloc(r->n_groups + 1, sizeof(int));
+    int *fill = malloc(sizeof(int) * r->n_groups);
+    int *tat = malloc(sizeof(int) * r->n);
+    int *rt = malloc(sizeof(int) * r->n);
+    long long total_used = 0;
+    int total_weight = 0;
+
+    for (int g = 0; g < r->n_groups; g++) {
+        total_used += r->groups[g].used;
+        total_weight += r->groups[g].weight;
+    }
+    // Bucket the served jobs by group
+    for (int i = 0; i < r->n; i++) {
+        if (!r->state[i].rejected) start[r->group_of[i] + 1]++;
+    }
+    for (int g = 0; g < r->n_groups; g++) start[g + 1] += start[g];
+    memcpy(fill, start, sizeof(int) * r->n_groups);
+    for (int i = 0; i < r->n; i++) {
+        if (r->state[i].rejected) continue;
+        tat[fill[r->group_of[i]]] = r->state[i].turnaround_time;
+        rt[fill[r->group_of[i]]++] = r->state[i].response_time;
+    }
+
+    printf("\n\nGroup Share Report:\n");
+    printf("==========================================================================================================\n");
+    printf("Group              Wt  Target  CPU%%    Entitled  Received  Ratio  TAT p50/p95/p99      RT p50/p95/p99\n");
+    printf("==========================================================================================================\n");
+    for (int g = 0; g < r->n_groups; g++) {
+        const FairGroup *grp = &r->groups[g];
+        int *t = tat + start[g], *q = rt + start[g], count = start[g + 1] - start[g];
+        char tat_pct[24], rt_pct[24];
+
+        qsort(t, count, sizeof(int), compare_int);
+        qsort(q, count, sizeof(int), compare_int);
+        snprintf(tat_pct, sizeof(tat_pct), "%d/%d/%d", percentile(t, count, 50),
+                 percentile(t, count, 95), percentile(t, count, 99));
+        snprintf(rt_pct, sizeof(rt_pct), "%d/%d/%d", percentile(q, count, 50),
+                 percentile(q, count, 95), percentile(q, count, 99));
+        printf("%-18.18s %-3d %5.1f%%  %5.1f%%  %-9.1f %-9lld %-6.2f %-20s %s\n", grp->name,
+               grp->weight, (double)grp->weight / total_weight * 100,
+               total_used ? (double)grp->used / total_used * 100 : 0.0, grp->entitled, grp->used,
+               grp->entitled > 0 ? grp->used / grp->entitled : 0.0, tat_pct, rt_pct);
+    }
+    printf("==========================================================================================================\n");
+    free(start);
+    free(fill);
+    free(tat);
+    free(rt);
+}
+
+// Critical path and how long jobs sat waiting for their predecessors
+static void print_dependency_report(const Job jobs[], const SchedRun *r, const Dag *dag) {
+    int critical_path = 0, makespan = 0;
+    long long total_work = 0;
+
+    for (int i = 0; i < r->n; i++) {
+        if (r->cp_rank[i] > critical_path) critical_path = r->cp_rank[i];
+        if (r->state[i].completion_time > makespan) makespan = r->state[i].completion_time;
+        total_work += jobs[i].burst_time;
+    }
+
+    printf("\n\nDependency Report:\n");
+    printf("========================================\n");
+    printf("Dependency Edges           : %d\n", dag->n_edges);
+    printf("Critical Path Length       : %d units\n", critical_path);
+    printf("Total CPU Work             : %lld units\n", total_work);
+    printf("Makespan                   : %d units\n", makespan);
+    printf("Makespan / Critical Path   : %.2f\n", critical_path ? (double)makespan / critical_path : 0.0);
+    printf("Dependency Wait Time       : %lld units\n", r->stats.dependency_wait);
+    printf("========================================\n");
+}
+
+// Averages over the jobs that ran, like summarize_run
+static double average_response(const JobState state[], int n) {
+    long long total = 0;
+    int served = 0;
+
+    for (int i = 0; i < n; i++) {
+        if (state[i].rejected) continue;            // never ran
+        total += state[i].response_time;
+        served++;
+    }
+    return served ? (double)total / served : 0.0;
+}
+
+static double average_waiting(const JobState state[], int n) {
+    long long total = 0;
+    int served = 0;
+
+    for (int i = 0; i < n; i++) {
+        if (state[i].rejected) continue;            // never ran
+        total += state[i].waiting_time;
+        served++;
+    }
+    return served ? (double)total / served : 0.0;
+}
+
+// Dispatch the workload again on real processes, with the same policy and
+// settings as the simulated run, and compare the two
+static int run_real_comparison(const Job jobs[], const SchedRun *model, const Scheduler *sched,
+                               const RunSettings *s, const Dag *dag, int unit_ms) {
+    JobState *live_state = malloc(sizeof(JobState) * model->n);
+    SchedRun live;
+    int status;
+
+    sched_init(&live, jobs, live_state, model->n, model->total_memory, s->quantum);
+    configure_run(&live, sched, s, dag);          // the simulated run already accepted s
+    status = run_real_execution(model, &live, sched->policy, unit_ms);
+
+    sched_free(&live);
+    free(live_state);
+    return status;
+}
+
+// Re-run the workload with the fixed quantum and every other setting of
+// the adaptive run, and report what the adaptive quantum changed
+static void print_quantum_comparison(const Job jobs[], const SchedRun *adaptive,
+                                     const RunSettings *s, const Dag *dag) {
+    const Scheduler *rr = find_scheduler(RR_POLICY.name);
+    JobState *fixed_state = malloc(sizeof(JobState) * adaptive->n);
+    SchedRun fixed;
+    char label[32];
+
+    sched_init(&fixed, jobs, fixed_state, adaptive->n, adaptive->total_memory, s->quantum);
+    configure_run(&fixed, rr, s, dag);            // the adaptive run already accepted s
+    fixed.verbose = 0;
+    rr->run(&fixed);
+
+    printf("\n\nAdaptive vs Fixed Quantum:\n");
+    printf("================================================================\n");
+    snprintf(label, sizeof(label), "Fixed (TQ=%d)", s->quantum);
+    printf("Metric                     %-14s %-11s Change\n", label, "Adaptive");
+    printf("================================================================\n");
+    printf("Context Switches           %-14d %-11d %+d\n", fixed.stats.context_switches,
+           adaptive->stats.context_switches, adaptive->stats.context_switches - fixed.stats.context_switches);
+    printf("Preemptions                %-14d %-11d %+d\n", fixed.stats.preemptions,
+           adaptive->stats.preemptions, adaptive->stats.preemptions - fixed.stats.preemptions);
+    printf("Average Response Time      %-14.2f %-11.2f %+.2f\n",
+           average_response(fixed_state, fixed.n), average_response(adaptive->state, adaptive->n),
+           average_response(adaptive->state, adaptive->n) - average_response(fixed_state, fixed.n));
+    printf("Average Waiting Time       %-14.2f %-11.2f %+.2f\n",
+           average_waiting(fixed_state, fixed.n), average_waiting(adaptive->state, adaptive->n),
+           average_waiting(adaptive->state, adaptive->n) - average_waiting(fixed_state, fixed.n));
+    printf("================================================================\n");
+    if (adaptive->n <= TRACE_PRINT_LIMIT) {
+        printf("\nPer-Process Response Time (Fixed -> Adaptive):\n");
+        for (int i = 0; i < adaptive->n; i++) {
+            printf("  %-4s %-30s %3d -> %-3d\n", jobs[i].name, jobs[i].type,
+                   fixed_state[i].response_time, adaptive->state[i].response_time);
+        }
+    }
+
+    sched_free(&fixed);
+    free(fixed_state);
+}
+
+static double average_turnaround(const JobState state[], int n) {
+    long long total = 0;
+    int served = 0;
+
+    for (int i = 0; i < n; i++) {
+        if (state[i].rejected) continue;            // never ran
+        total += state[i].turnaround_time;
+        served++;
+    }
+    return served ? (double)total / served : 0.0;
+}
+
+// How far the predictions were off, and what that cost against SJF with
+// the true burst times (re-run on the same workload and settings)
+static void print_prediction_report(const Job jobs[], const SchedRun *predicted,
+                                    const RunSettings *s, const Dag *dag) {
+    const Scheduler *sjf = find_scheduler(SJF_POLICY.name);
+    const RunStats *st = &predicted->stats;
+    JobState *oracle_state = malloc(sizeof(JobState) * predicted->n);
+    SchedRun oracle;
+    long long actual = 0;
+    double oracle_wt, predicted_wt;
+
+    sched_init(&oracle, jobs, oracle_state, predicted->n, predicted->total_memory, s->quantum);
+    configure_run(&oracle, sjf, s, dag);          // the predicted run already accepted s
+    oracle.verbose = 0;
+    sjf->run(&oracle);
+
+    for (int i = 0; i < predicted->n; i++) {
+        if (!predicted->state[i].rejected) actual += jobs[i].burst_time;
+    }
+    oracle_wt = average_waiting(oracle_state, oracle.n);
+    predicted_wt = average_waiting(predicted->state, predicted->n);
+
+    printf("\n\nBurst Prediction Report:\n");
+    printf("================================================================\n");
+    if (predicted->predict_mode == PREDICT_EMA) {
+        printf("Estimator                  : exponential average, alpha %.2f\n", predicted->alpha);
+    } else {
+        printf("Estimator                  : p%.0f of past bursts (P2)\n", predicted->quantile * 100);
+    }
+    printf("Predicted Bursts           : %lld\n", st->predicted_bursts);
+    printf("Mean Absolute Error        : %.2f units\n",
+           st->predicted_bursts ? (double)st->predict_abs_error / st->predicted_bursts : 0.0);
+    printf("Mean Error (bias)          : %+.2f units\n",
+           st->predicted_bursts ? (double)st->predict_error / st->predicted_bursts : 0.0);
+    printf("Relative Absolute Error    : %.1f%% of CPU time\n",
+           actual ? (double)st->predict_abs_error / actual * 100 : 0.0);
+    printf("================================================================\n");
+    printf("Metric                     %-14s %-11s Change\n", "Oracle SJF", "Predicted");
+    printf("================================================================\n");
+    printf("Average Waiting Time       %-14.2f %-11.2f %+.2f (%+.1f%%)\n", oracle_wt, predicted_wt,
+           predicted_wt - oracle_wt, oracle_wt > 0 ? (predicted_wt - oracle_wt) / oracle_wt * 100 : 0.0);
+    printf("Average Turnaround Time    %-14.2f %-11.2f %+.2f\n",
+           average_turnaround(oracle_state, oracle.n), average_turnaround(predicted->state, predicted->n),
+           average_turnaround(predicted->state, predicted->n) - average_turnaround(oracle_state, oracle.n));
+    printf("Average Response Time      %-14.2f %-11.2f %+.2f\n",
+           average_response(oracle_state, oracle.n), average_response(predicted->state, predicted->n),
+           average_response(predicted->state, predicted->n) - average_response(oracle_state, oracle.n));
+    printf("================================================================\n");
+
+    sched_free(&oracle);
+    free(oracle_state);
+}
+
+// CPU each job received against what its tickets entitled it to while it
+// was runnable, by ticket count
+static void print_ticket_report(const Job jobs[], const SchedRun *r) {
+    // One ticket count per priority level, or per group weight
+    int *classes = malloc(sizeof(int) * (TICKET_PRIORITY_LEVELS + r->n_groups));
+    int n_classes = 0, served = 0, worst = -1;
+    double total_error = 0, total_received = 0, total_entitled = 0, worst_error = 0;
+
+    for (int i = 0; i < r->n; i++) {
+        int tickets = job_tickets(r, i), c = 0;
+        while (c < n_classes && classes[c] != tickets) c++;
+        if (c == n_classes) classes[n_classes++] = tickets;
+    }
+    qsort(classes, n_classes, sizeof(int), compare_int);
+
+    printf("\n\nTicket Share Report (tickets by %s):\n",
+           r->tickets_by == TICKETS_BY_TYPE ? "type" : "priority");
+    printf("======================================================================\n");
+    printf("Tickets  Jobs     Entitled      Received      Ratio   Mean |Error|\n");
+    printf("======================================================================\n");
+    for (int c = n_classes - 1; c >= 0; c--) {
+        double entitled = 0, received = 0, error = 0;
+        int count = 0;
+
+        for (int i = 0; i < r->n; i++) {
+            const JobState *st = &r->state[i];
+            double off = jobs[i].burst_time - st->entitled;
+
+            if (st->rejected || job_tickets(r, i) != classes[c]) continue;
+            if (off < 0) off = -off;
+            count++;
+            entitled += st->entitled;
+            received += jobs[i].burst_time;
+            error += off;
+            if (worst < 0 || off > worst_error) {
+                worst = i;
+                worst_error = off;
+            }
+        }
+        if (count == 0) continue;
+        printf("%-8d %-8d %-13.1f %-13.0f %-7.3f %.2f\n", classes[c], count, entitled, received,
+               entitled > 0 ? received / entitled : 0.0, error / count);
+        served += count;
+        total_entitled += entitled;
+        total_received += received;
+        total_error += error;
+    }
+    printf("======================================================================\n");
+    printf("Mean Absolute Share Error  : %.2f units per job (%.1f%% of entitled CPU)\n",
+           served ? total_error / served : 0.0, total_entitled > 0 ? total_error / total_entitled * 100 : 0.0);
+    printf("CPU Off Ticket Share       : %.2f%% of all CPU\n",
+           total_received > 0 ? total_error / 2 / total_received * 100 : 0.0);
+    if (worst >= 0) {
+        printf("Largest Share Error        : %+.2f units (%s, entitled %.2f)\n",
+               jobs[worst].burst_time - r->state[worst].entitled, jobs[worst].name, r->state[worst].entitled);
+    }
+    printf("======================================================================\n");
+    free(classes);
+}
+
+// Metrics of a streamed run, from the totals it kept of retired jobs;
+// percentiles are P² estimates
+static void print_stream_metrics(const SchedRun *r, double exec_time) {
+    const StreamTotals *t = &r->totals;
+    const RunStats *stats = &r->stats;
+    int overhead = stats->switch_overhead + stats->cache_overhead;
+    double served = t->served > 0 ? (double)t->served : 1;
+    double makespan = t->makespan > 0 ? (double)t->makespan : 1;
+    long long ran_with_deadline = t->with_deadline - t->rejected;
+
+    printf("\n\nPerformance Metrics (streamed):\n");
+    printf("========================================\n");
+    printf("Jobs Completed             : %lld\n", t->served);
+    printf("Jobs Rejected              : %lld\n", t->rejected);
+    printf("Average Waiting Time       : %.2f units\n", t->total_wt / served);
+    printf("Average Turnaround Time    : %.2f units\n", t->total_tat / served);
+    printf("Average Response Time      : %.2f units\n", t->total_rt / served);
+    printf("Turnaround p50 / p95 / p99 : %.0f / %.0f / %.0f units\n",
+           estimator_quantile(&t->tat[0], 0.50), estimator_quantile(&t->tat[1], 0.95),
+           estimator_quantile(&t->tat[2], 0.99));
+    printf("Response p50 / p95 / p99   : %.0f / %.0f / %.0f units\n",
+           estimator_quantile(&t->rt[0], 0.50), estimator_quantile(&t->rt[1], 0.95),
+           estimator_quantile(&t->rt[2], 0.99));
+    printf("Throughput                 : %.4f processes/unit\n", t->served / makespan);
+    printf("CPU Utilization            : %.2f%%\n", t->total_burst / makespan * 100);
+    printf("CPU Busy (incl. overhead)  : %.2f%%\n", (t->total_burst + overhead) / makespan * 100);
+    printf("Context Switches           : %d\n", stats->context_switches);
+    printf("Preemptions                : %d\n", stats->preemptions);
+    printf("Total Execution Time       : %d units\n", t->makespan);
+    printf("Total Swap Time            : %lld units\n", t->total_swap_time);
+    printf("Processes Swapped Out      : %lld\n", t->swapped);
+    printf("Memory Waits               : %d\n", stats->memory_waits);
+    printf("Memory Stall Time          : %lld units\n", stats->memory_stall);
+    if (stats->io_operations > 0) {
+        printf("I/O Operations             : %d\n", stats->io_operations);
+        for (int d = 0; d < stats->n_devices; d++) {
+            printf("Device %d Utilization       : %.2f%%\n", d,
+                   stats->device_busy[d] / makespan * 100);
+        }
+    }
+    printf("Deadline Miss Ratio        : %.2f%%\n",
+           t->with_deadline ? (double)(t->missed + t->rejected) / t->with_deadline * 100 : 0.0);
+    printf("Average Tardiness          : %.2f units\n",
+           ran_with_deadline > 0 ? (double)t->total_tardiness / ran_with_deadline : 0.0);
+    printf("Tardiness p50 / p95 / p99  : %.0f / %.0f / %.0f units\n",
+           estimator_quantile(&t->tardiness[0], 0.50), estimator_quantile(&t->tardiness[1], 0.95),
+           estimator_quantile(&t->tardiness[2], 0.99));
+    printf("Maximum Tardiness          : %d units\n", t->max_tardiness);
+    printf("Job Slots (peak in flight) : %d\n", r->n);
+#ifndef _WIN32
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) printf("Peak RSS                   : %ld KB\n", usage.ru_maxrss);
+#endif
+    printf("Program Execution Time     : %.6f seconds\n", exec_time);
+    printf("========================================\n");
+}
+
+static void print_banner(const Scheduler *sched, const RunSettings *s) {
+    printf("========================================\n");
+    printf("  %s Scheduling Algorithm\n", sched->policy->title);
+    printf("  (%s)\n", sched->policy->mode);
+    if (sched->policy->slice == slice_quantum || sched->policy->slice == slice_stride) {
+        printf("  Time Quantum = %d units\n", s->quantum);
+    }
+    if (sched->policy->slice == slice_adaptive) {
+        printf("  Time Quantum = %d..%d units per round\n", ADAPTIVE_MIN_QUANTUM, ADAPTIVE_MAX_QUANTUM);
+    }
+    if (sched->policy->enqueue == enqueue_edf) {
+        printf("  Admission Control = %s\n",
+               s->admission == ADMIT_NONE ? "none" : s->admission == ADMIT_REJECT ? "reject" : "defer");
+    }
+    if (sched->policy->enqueue == enqueue_predicted) {
+        if (s->predict_mode == PREDICT_EMA) printf("  Burst Estimate = EMA, alpha %.2f", s->alpha);
+        else printf("  Burst Estimate = p%d of past bursts", s->predict_percentile);
+        printf(" per %s\n", s->predict_key == PREDICT_BY_NAME ? "name" : "type");
+    }
+    if (sched->policy->enqueue == enqueue_lottery || sched->policy->enqueue == enqueue_stride) {
+        printf("  Tickets = %d per share, by %s\n", TICKETS_PER_SHARE,
+               s->tickets_by == TICKETS_BY_TYPE ? "type" : "priority");
+    }
+    printf("  Cross-Platform (Windows/Linux)\n");
+    printf("========================================\n\n");
+}
+
+static void print_compare_banner(const Scheduler *picked[], int k, const RunSettings *s) {
+    printf("========================================\n");
+    printf("  Policy Comparison\n");
+    printf("  (");
+    for (int i = 0; i < k; i++) printf("%s%s", i ? ", " : "", picked[i]->policy->name);
+    printf(")\n");
+    printf("  Time Quantum = %d units\n", s->quantum);
+    printf("  Cross-Platform (Windows/Linux)\n");
+    printf("========================================\n\n");
+}
+
+// Every picked policy runs on its own thread over one read-only copy of
+// the jobs, then the results are printed side by side
+static int run_comparison(const Job jobs[], int n, const Dag *dag, const RunSettings *s,
+                          const Scheduler *picked[], int k) {
+    CompareRun runs[NUM_SCHEDULERS];
+    size_t bytes = 0;
+    const Job *shared = share_jobs(jobs, n, &bytes);
+    const Job *trace = shared ? shared : jobs;
+    double wall;
+
+    if (shared) printf("Workload shared read-only by %d threads (%.1f KB)\n", k, bytes / 1024.0);
+    else printf("Workload could not be made read-only; %d threads share it as loaded\n", k);
+    printf("Private state per policy: %d bytes per job\n", (int)sizeof(JobState));
+    for (int i = 0; i < k; i++) {
+        runs[i].sched = picked[i];
+        runs[i].state = malloc(sizeof(JobState) * n);
+        runs[i].seconds = 0;
+        sched_init(&runs[i].run, trace, runs[i].state, n, TOTAL_MEMORY, s->quantum);
+        runs[i].run.verbose = 0;
+        if (configure_run(&runs[i].run, picked[i], s, dag) != 0) {
+            for (int j = 0; j <= i; j++) {
+                sched_free(&runs[j].run);
+                free(runs[j].state);
+            }
+            if (shared) unshare_jobs(shared, bytes);
+            return 1;
+        }
+    }
+
+    wall = run_concurrently(runs, k);
+    print_comparison(trace, runs, k, wall);
+    for (int i = 0; i < k; i++) {
+        PROF_REPORT(&runs[i].run, runs[i].sched->policy->name);
+        sched_free(&runs[i].run);
+        free(runs[i].state);
+    }
+    if (shared) unshare_jobs(shared, bytes);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    Job *jobs;
+    JobState *state;
+    SchedRun run;
+    const Scheduler *sched = NULL;
+    const Scheduler *picked[NUM_SCHEDULERS];
+    int compare, n_picked = 0;
+    const char *policies = COMPARE_POLICIES;
+    RunSettings settings;
+    int quantum = TIME_QUANTUM;
+    int switch_cost = CONTEXT_SWITCH_COST;
+    int cache_penalty = CACHE_WARMTH_PENALTY;
+    int real_unit_ms = 0;
+    int admission = ADMIT_DEFER;
+    int packing = PACK_FIRST_FIT;
+    int io_mix = 0;
+    int devices = 1;
+    int builtin_dag = 0;
+    const char *deps = NULL;
+    Dag dag = {0};
+    int inner = INNER_RR;
+    const char *weights = NULL;
+    int predict_mode = PREDICT_EMA;
+    int predict_percentile = 50;
+    int predict_key = PREDICT_BY_TYPE;
+    double alpha = PREDICT_ALPHA;
+    int tickets_by = TICKETS_BY_PRIORITY;
+    int tickets_given = 0;
+    unsigned long long seed = LOTTERY_SEED;
+    const char *trace = NULL;
+    const char *stream_path = NULL;
+    const char *results_path = NULL;
+    JobStream stream;
+    int n;
+    double start_time, end_time;
+
+    if (argc < 2) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    compare = strcmp(argv[1], "compare") == 0;
+    if (!compare && (sched = find_scheduler(argv[1])) == NULL) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    for (int i = 2; i < argc; i++) {
+        if ((strcmp(argv[i], "-q") == 0 || strcmp(argv[i], "--quantum") == 0) && i + 1 < argc) {
+            quantum = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--switch-cost") == 0 && i + 1 < argc) {
+            switch_cost = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--cache-penalty") == 0 && i + 1 < argc) {
+            cache_penalty = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--real") == 0) {
+            real_unit_ms = REAL_UNIT_MS;
+            if (i + 1 < argc && argv[i + 1][0] != '-') real_unit_ms = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace = argv[++i];
+        } else if (strcmp(argv[i], "--stream") == 0 && i + 1 < argc) {
+            stream_path = argv[++i];
+        } else if (strcmp(argv[i], "--results") == 0 && i + 1 < argc) {
+            results_path = argv[++i];
+        } else if (strcmp(argv[i], "--admission") == 0 && i + 1 < argc) {
+            i++;
+            if (strcmp(argv[i], "none") == 0) admission = ADMIT_NONE;
+            else if (strcmp(argv[i], "reject") == 0) admission = ADMIT_REJECT;
+            else if (strcmp(argv[i], "defer") == 0) admission = ADMIT_DEFER;
+            else {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--io-mix") == 0) {
+            io_mix = 1;
+        } else if (strcmp(argv[i], "--dag") == 0) {
+            builtin_dag = 1;
+        } else if (strcmp(argv[i], "--deps") == 0 && i + 1 < argc) {
+            deps = argv[++i];
+        } else if (strcmp(argv[i], "--inner") == 0 && i + 1 < argc) {
+            i++;
+            if (strcmp(argv[i], "fcfs") == 0) inner = INNER_FCFS;
+            else if (strcmp(argv[i], "sjf") == 0) inner = INNER_SJF;
+            else if (strcmp(argv[i], "rr") == 0) inner = INNER_RR;
+            else if (strcmp(argv[i], "priority") == 0) inner = INNER_PRIORITY;
+            else if (strcmp(argv[i], "edf") == 0) inner = INNER_EDF;
+            else {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--weights") == 0 && i + 1 < argc) {
+            weights = argv[++i];
+        } else if (strcmp(argv[i], "--predictor") == 0 && i + 1 < argc) {
+            i++;
+            if (strcmp(argv[i], "ema") == 0) {
+                predict_mode = PREDICT_EMA;
+            } else if (argv[i][0] == 'p' && (predict_percentile = atoi(argv[i] + 1)) >= 1 &&
+                       predict_percentile <= 99) {
+                predict_mode = PREDICT_PERCENTILE;
+            } else {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--alpha") == 0 && i + 1 < argc) {
+            alpha = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--predict-key") == 0 && i + 1 < argc) {
+            i++;
+            if (strcmp(argv[i], "type") == 0) predict_key = PREDICT_BY_TYPE;
+            else if (strcmp(argv[i], "name") == 0) predict_key = PREDICT_BY_NAME;
+            else {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--tickets") == 0 && i + 1 < argc) {
+            i++;
+            tickets_given = 1;
+            if (strcmp(argv[i], "priority") == 0) tickets_by = TICKETS_BY_PRIORITY;
+            else if (strcmp(argv[i], "type") == 0) tickets_by = TICKETS_BY_TYPE;
+            else {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--policies") == 0 && i + 1 < argc && compare) {
+            policies = argv[++i];
+        } else if (strcmp(argv[i], "--devices") == 0 && i + 1 < argc) {
+            devices = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--packing") == 0 && i + 1 < argc) {
+            i++;
+            if (strcmp(argv[i], "fifo") == 0) packing = PACK_FIFO;
+            else if (strcmp(argv[i], "first-fit") == 0) packing = PACK_FIRST_FIT;
+            else if (strcmp(argv[i], "best-fit") == 0) packing = PACK_BEST_FIT;
+            else {
+                print_usage(argv[0]);
+                return 1;
+            }
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    if (quantum < 1) {
+        fprintf(stderr, "Time quantum must be at least 1\n");
+        return 1;
+    }
+    if (real_unit_ms < 0) {
+        fprintf(stderr, "Real-execution time unit must be positive\n");
+        return 1;
+    }
+    if (devices < 1 || devices > MAX_IO_DEVICES) {
+        fprintf(stderr, "Number of I/O devices must be between 1 and %d\n", MAX_IO_DEVICES);
+        return 1;
+    }
+    if (switch_cost < 0 || cache_penalty < 0) {
+        fprintf(stderr, "Switch cost and cache penalty cannot be negative\n");
+        return 1;
+    }
+    if (alpha <= 0 || alpha > 1) {
+        fprintf(stderr, "Alpha must be in (0, 1]\n");
+        return 1;
+    }
+    if (compare && (stream_path || results_path || real_unit_ms > 0)) {
+        fprintf(stderr, "compare cannot be combined with --stream, --results or --real\n");
+        return 1;
+    }
+    if (compare && (n_picked = parse_policies(policies, picked)) < 0) return 1;
+    if (stream_path && (trace || io_mix || builtin_dag || deps || real_unit_ms > 0)) {
+        fprintf(stderr, "--stream cannot be combined with --trace, --io-mix, --dag, --deps or --real\n");
+        return 1;
+    }
+    if (stream_path && (sched->policy->enqueue == enqueue_edf || sched->policy->enqueue == enqueue_critical ||
+                        sched->policy->enqueue == enqueue_predicted || inner == INNER_EDF)) {
+        fprintf(stderr, "%s needs the whole trace up front and cannot stream\n",
+                inner == INNER_EDF ? "--inner edf" : sched->policy->name);
+        return 1;
+    }
+    if (results_path && !stream_path) {
+        fprintf(stderr, "--results needs --stream\n");
+        return 1;
+    }
+
+    settings.quantum = quantum;
+    settings.switch_cost = switch_cost;
+    settings.cache_penalty = cache_penalty;
+    settings.admission = admission;
+    settings.packing = packing;
+    settings.devices = devices;
+    settings.inner = inner;
+    settings.weights = weights;
+    settings.predict_mode = predict_mode;
+    settings.predict_percentile = predict_percentile;
+    settings.predict_key = predict_key;
+    settings.alpha = alpha;
+    settings.tickets_by = tickets_by;
+    settings.tickets_given = tickets_given;
+    settings.seed = seed;
+
+    if (compare) print_compare_banner(picked, n_picked, &settings);
+    else print_banner(sched, &settings);
+
+    if (stream_path) {
+        if (stream_open(&stream, stream_path) != 0) return 1;
+        printf("Streaming processes from %s\n", stream_path);
+        n = 0;
+        jobs = NULL;
+    } else if (trace) {
+        if ((n = load_trace(trace, &jobs)) < 0) return 1;
+        printf("Loaded %d processes from %s\n", n, trace);
+    } else {
+        n = MAX_PROCESSES;
+        jobs = malloc(sizeof(Job) * n);
+        if (io_mix) initialize_io_processes(jobs);
+        else initialize_processes(jobs);
+        printf("Initialized %d processes\n", n);
+    }
+    if (real_unit_ms > 0 && n > REAL_MAX_WORKERS) {
+        fprintf(stderr, "--real forks one worker per job and takes at most %d jobs\n", REAL_MAX_WORKERS);
+        free(jobs);
+        return 1;
+    }
+    if (deps) {
+        if (load_deps(deps, n, &dag) != 0) {
+            free(jobs);
+            return 1;
+        }
+        printf("Loaded %d dependencies from %s\n", dag.n_edges, deps);
+    } else if (builtin_dag) {
+        if (trace) {
+            fprintf(stderr, "--dag applies to the built-in workload; use --deps with a trace\n");
+            free(jobs);
+            return 1;
+        }
+        dag_builtin(&dag, n);
+        printf("Pipeline dependencies: P9 <- P1, P5; P10 <- P3, P5\n");
+    }
+    printf("Total Available Memory: %d MB\n\n", TOTAL_MEMORY);
+    if (compare) {
+        int failed = run_comparison(jobs, n, &dag, &settings, picked, n_picked);
+
+        dag_free(&dag);
+        free(jobs);
+        return failed;
+    }
+    if (stream_path) {
+        state = NULL;                                // the run owns its slots
+        sched_init_stream(&run, &stream, TOTAL_MEMORY, quantum);
+        if (results_path && !(run.results = fopen(results_path, "w"))) {
+            perror(results_path);
+            sched_free(&run);
+            stream_close(&stream);
+            return 1;
+        }
+        if (run.results) fprintf(run.results, "name,type,arrival,start,completion,turnaround,waiting,response,status\n");
+    } else {
+        state = malloc(sizeof(JobState) * n);
+        sched_init(&run, jobs, state, n, TOTAL_MEMORY, quantum);
+    }
+    if (configure_run(&run, sched, &settings, &dag) != 0) {
+        if (run.results) fclose(run.results);
+        sched_free(&run);
+        dag_free(&dag);
+        free(state);
+        free(jobs);
+        return 1;
+    }
+    run.verbose = !stream_path && n <= TRACE_PRINT_LIMIT;
+
+    start_time = get_time();
+    sched->run(&run);
+    end_time = get_time();
+
+    if (stream_path) {
+        int failed = stream.error;
+
+        // Totals over the jobs before a bad line would pass for a result
+        if (failed) {
+            fprintf(stderr, "%s: stream stopped at line %d; no metrics for a partial run\n",
+                    stream_path, stream.line_no);
+        } else {
+            print_stream_metrics(&run, end_time - start_time);
+            PROF_REPORT(&run, sched->policy->name);
+        }
+        if (run.results) {
+            fclose(run.results);
+            printf("Per-job results %swritten to %s\n", failed ? "(partial) " : "", results_path);
+        }
+        stream_close(&stream);
+        sched_free(&run);
+        return failed;
+    }
+    if (n <= TRACE_PRINT_LIMIT) {
+        print_process_table(jobs, state, n);
+        print_gantt_chart(jobs, run.slices, run.n_slices);
+    }
+    print_performance_metrics(jobs, state, n, &run.stats, end_time - start_time);
+    print_deadline_report(jobs, state, n, &run.stats);
+    if (dag.n > 0) print_dependency_report(jobs, &run, &dag);
+    print_group_report(&run);
+    if (run.tickets_by != TICKETS_NONE) print_ticket_report(jobs, &run);
+    PROF_REPORT(&run, sched->policy->name);
+    if (sched->policy->slice == slice_adaptive) print_quantum_comparison(jobs, &run, &settings, &dag);
+    if (sched->policy->enqueue == enqueue_predicted) print_prediction_report(jobs, &run, &settings, &dag);
+    if (real_unit_ms > 0 && run_real_comparison(jobs, &run, sched, &settings, &dag, real_unit_ms) != 0) {
+        sched_free(&run);
+        dag_free(&dag);
+        free(state);
+        free(jobs);
+        return 1;
+    }
+
+    printf("\n\nScenario Analysis:\n");
+    printf("========================================\n");
+    printf("%s", sched->policy->analysis);
+    printf("========================================\n\n");
+
+    sched_free(&run);
+    dag_free(&dag);
+    free(state);
+    free(jobs);
+    return 0;
+}
@@ -0,0 +1,721 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <time.h>
+#else
+    #include <unistd.h>
+    #include <sys/time.h>
+#endif
+
+#define MAX_PROCESSES 10
+#define SWAP_TIME 2
+#define TOTAL_MEMORY 6000
+#define TIME_QUANTUM 3
+#define ADAPTIVE_MIN_QUANTUM 1
+#define ADAPTIVE_MAX_QUANTUM 8
+#define ADAPTIVE_ROUND_TARGET 24       // longest round the adaptive RR aims for
+#define CONTEXT_SWITCH_COST 0          // time units per context switch
+#define CACHE_WARMTH_PENALTY 0         // time units to rewarm a resumed job's cache
+#define NO_DEADLINE INT_MAX
+#define MAX_BURSTS 9                   // CPU, I/O, CPU, ... per job
+#define MAX_IO_DEVICES 8
+
+// Relative deadline = SWAP_TIME + factor * burst, picked by job type
+#define DEADLINE_CRITICAL 2            // "(critical)" web requests
+#define DEADLINE_INTERACTIVE 4         // other web and API requests
+#define DEADLINE_QUERY 6               // database queries
+#define DEADLINE_BACKGROUND 12         // reports, data processing; batch has none
+
+// Default CPU weights of the job-type groups used by fair share
+#define SHARE_WEB 4
+#define SHARE_API 3
+#define SHARE_DATABASE 2
+#define SHARE_OTHER 1
+
+// Lottery and stride tickets: a job holds TICKETS_PER_SHARE per share, and
+// its shares are either 6 - priority (priorities 1..5) or its group's weight
+#define TICKETS_PER_SHARE 100
+#define TICKET_PRIORITY_LEVELS 5
+#define LOTTERY_SEED 1
+
+// Burst prediction for the predicted-SJF policy
+#define PREDICT_ALPHA 0.5              // weight of the newest burst in the average
+#define PREDICT_INITIAL_BURST 5        // guess before any burst has been seen
+
+// ─────────────────────────────────────────────────────────
+// Workload and per-run state
+//
+// A Job is one row of the workload and is never written once loaded;
+// everything a scheduler changes while running lives in its JobState,
+// so several policies can run over the same Job array.
+// ─────────────────────────────────────────────────────────
+
+typedef struct {
+    int pid;
+    char name[20];
+    char type[50];
+    int arrival_time;
+    int burst_time;
+    int priority;                  // lower number = higher priority
+    int memory_required;
+    int deadline;                  // absolute; NO_DEADLINE if the job has none
+    int n_bursts;                  // odd: CPU bursts at even positions, I/O between
+    int bursts[MAX_BURSTS];
+    int io_time;                   // total of the I/O bursts
+} Job;
+
+typedef struct {
+    int remaining_time;
+    int start_time;
+    int completion_time;
+    int turnaround_time;
+    int waiting_time;
+    int response_time;
+    int total_swap_time;
+    int is_swapped;
+    int is_completed;
+    int started;
+    int started_slices;
+    int rejected;                  // refused by admission control, never ran
+    int deferred;                  // admitted without a deadline guarantee
+    int memory_stall;              // time spent waiting for memory
+    int wait_since;
+    int reserved;                  // released from the memory queue, memory held for it
+    int burst_index;               // position in the job's burst sequence
+    int burst_left;                // CPU time left in the current burst
+    int blocked_time;              // time spent queued for and doing I/O
+    int io_done;                   // when the current I/O finishes
+    int runnable;                  // ready or running (not blocked, waiting or done)
+    double entitled;               // CPU its tickets entitled it to while runnable
+    double share_mark;             // share clock when it last became runnable
+} JobState;
+
+// Counters a run accumulates besides the per-job results
+typedef struct {
+    int context_switches;
+    int preemptions;
+    int swap_operations;
+    int switch_overhead;           // time spent switching
+    int cache_overhead;            // time spent rewarming caches
+    int rejected;
+    int deferred;
+    int memory_waits;              // times a job was held back for memory
+    long long memory_stall;        // total time jobs spent waiting for memory
+    int io_operations;
+    int n_devices;
+    long long device_busy[MAX_IO_DEVICES];
+    long long dependency_wait;     // time arrived jobs spent waiting on predecessors
+    long long predicted_bursts;    // CPU bursts run with a predicted length
+    long long predict_abs_error;   // sum of |predicted - actual|
+    long long predict_error;       // sum of predicted - actual
+} RunStats;
+
+typedef struct {
+    int job;
+    int start;
+    int end;
+} Slice;
+
+// Cross-platform timing function
+static inline double get_time(void) {
+#ifdef _WIN32
+    return (double)clock() / CLOCKS_PER_SEC;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+#endif
+}
+
+static inline int deadline_for_type(const char *type, int arrival, int burst) {
+    int factor;
+
+    if (strstr(type, "(critical)")) factor = DEADLINE_CRITICAL;
+    else if (strstr(type, "Web Request") || strstr(type, "API Request")) factor = DEADLINE_INTERACTIVE;
+    else if (strstr(type, "Database")) factor = DEADLINE_QUERY;
+    else if (strstr(type, "Batch")) return NO_DEADLINE;
+    else factor = DEADLINE_BACKGROUND;
+    return arrival + SWAP_TIME + factor * burst;
+}
+
+// Jobs are grouped by type, ignoring any "(...)" qualifier, so all web
+// requests form one group
+static inline void type_group(const char *type, char group[50]) {
+    const char *paren = strstr(type, " (");
+    int len = paren ? (int)(paren - type) : (int)strlen(type);
+
+    if (len > 49) len = 49;
+    memcpy(group, type, len);
+    group[len] = '\0';
+}
+
+static inline int default_group_weight(const char *group) {
+    if (strcmp(group, "Web Request") == 0) return SHARE_WEB;
+    if (strcmp(group, "API Request") == 0) return SHARE_API;
+    if (strcmp(group, "Database Query") == 0) return SHARE_DATABASE;
+    return SHARE_OTHER;
+}
+
+static inline void set_job(Job *job, int pid, const char *name, const char *type,
+                           int arrival, int burst, int priority, int memory) {
+    job->pid = pid;
+    strcpy(job->name, name);
+    strcpy(job->type, type);
+    job->arrival_time = arrival;
+    job->burst_time = burst;
+    job->priority = priority;
+    job->memory_required = memory;
+    job->deadline = deadline_for_type(type, arrival, burst);
+    job->n_bursts = 1;
+    job->bursts[0] = burst;
+    job->io_time = 0;
+}
+
+// Replace a job's single CPU burst with an alternating CPU/I-O sequence
+static inline void set_bursts(Job *job, const int seq[], int n) {
+    job->n_bursts = n;
+    job->burst_time = 0;
+    job->io_time = 0;
+    for (int k = 0; k < n; k++) {
+        job->bursts[k] = seq[k];
+        if (k % 2 == 0) job->burst_time += seq[k];
+        else job->io_time += seq[k];
+    }
+    // The I/O is part of the response the deadline covers
+    job->deadline = deadline_for_type(job->type, job->arrival_time, job->burst_time);
+    if (job->deadline != NO_DEADLINE) job->deadline += job->io_time;
+}
+
+// Priority assignments: Critical web requests = 1, Short tasks = 2, Database = 3, Batch = 4-5
+static inline void initialize_processes(Job jobs[]) {
+    set_job(&jobs[0], 1, "P1", "Batch Analytics", 0, 5, 5, 2500);
+    set_job(&jobs[1], 2, "P2", "Web Request (critical)", 1, 3, 1, 512);
+    set_job(&jobs[2], 3, "P3", "Batch Analytics (long-running)", 2, 8, 5, 3200);
+    set_job(&jobs[3], 4, "P4", "Web Request (short)", 1, 2, 1, 256);
+    set_job(&jobs[4], 5, "P5", "Database Query", 3, 4, 3, 1024);
+    set_job(&jobs[5], 6, "P6", "Web Request (quick)", 5, 1, 1, 128);
+    set_job(&jobs[6], 7, "P7", "Web Request", 4, 2, 2, 384);
+    set_job(&jobs[7], 8, "P8", "API Request", 4, 2, 2, 448);
+    set_job(&jobs[8], 9, "P9", "Report Generation", 7, 6, 4, 1800);
+    set_job(&jobs[9], 10, "P10", "Data Processing", 6, 5, 3, 1200);
+}
+
+// The same jobs with the same CPU demand, but the web, API and database
+// requests spend most of their life waiting on I/O between short bursts
+static inline void initialize_io_processes(Job jobs[]) {
+    static const int web_critical[] = {1, 4, 1, 4, 1};
+    static const int web_short[] = {1, 5, 1};
+    static const int database[] = {1, 6, 1, 6, 1, 6, 1};
+    static const int web[] = {1, 4, 1};
+    static const int api[] = {1, 5, 1};
+    static const int data[] = {2, 3, 3};
+
+    initialize_processes(jobs);
+    set_bursts(&jobs[1], web_critical, 5);
+    set_bursts(&jobs[3], web_short, 3);
+    set_bursts(&jobs[4], database, 7);
+    set_bursts(&jobs[6], web, 3);
+    set_bursts(&jobs[7], api, 3);
+    set_bursts(&jobs[9], data, 3);
+}
+
+// "c/i/c/..." into a burst sequence; 0 if malformed
+static inline int parse_bursts(const char *text, int seq[]) {
+    int n = 0;
+
+    while (n < MAX_BURSTS) {
+        char *end;
+        long v = strtol(text, &end, 10);
+        if (end == text || v < 1) return 0;
+        seq[n++] = (int)v;
+        if (*end != '/') return n % 2 == 1 && (*end == '\0' || *end == '\n' || *end == '\r') ? n : 0;
+        text = end + 1;
+    }
+    return 0;
+}
+
+// CSV trace, one job per line:
+//   name,type,arrival,burst,priority,memory[,deadline[,bursts]]
+// The deadline is an absolute time, "none", or "auto" (derived from the
+// type, also used when it is missing).  bursts is an alternating CPU/I-O
+// sequence such as 1/6/2 and replaces the burst column.  Blank lines,
+// '#' comments and a header (a malformed first line) are skipped.
+//
+// Parses one line into job: 1 for a job, 0 for a line to skip, -1 (after
+// printing why) for a malformed line.
+static inline int parse_trace_line(const char *path, int line_no, const char *line, int pid, Job *job) {
+    char name[20], type[50], deadline[16], burst_seq[128];
+    int arrival, burst, priority, memory, fields, seq[MAX_BURSTS], n_seq = 0;
+
+    if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') return 0;
+    fields = sscanf(line, " %19[^,],%49[^,],%d,%d,%d,%d,%15[^,\r\n],%127[^,\r\n]", name, type,
+                    &arrival, &burst, &priority, &memory, deadline, burst_seq);
+    if (fields < 6) {
+        if (line_no == 1) return 0;                     // header
+        fprintf(stderr, "%s:%d: expected name,type,arrival,burst,priority,memory"
+                        "[,deadline[,bursts]]\n", path, line_no);
+        return -1;
+    }
+    if (fields == 8 && (n_seq = parse_bursts(burst_seq, seq)) == 0) {
+        fprintf(stderr, "%s:%d: bursts must be an odd-length list like 2/5/1 (at most %d)\n",
+                path, line_no, MAX_BURSTS);
+        return -1;
+    }
+    if (arrival < 0 || burst < 1 || memory < 0) {
+        fprintf(stderr, "%s:%d: invalid arrival, burst or memory\n", path, line_no);
+        return -1;
+    }
+    set_job(job, pid, name, type, arrival, burst, priority, memory);
+    if (n_seq > 0) set_bursts(job, seq, n_seq);
+    if (fields >= 7 && strcmp(deadline, "auto") != 0) {
+        job->deadline = strcmp(deadline, "none") == 0 ? NO_DEADLINE : atoi(deadline);
+    }
+    return 1;
+}
+
+static inline int load_trace(const char *path, Job **out) {
+    FILE *f = fopen(path, "r");
+    char line[512];
+    Job *jobs = NULL;
+    int n = 0, cap = 0, line_no = 0;
+
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        int got;
+
+        if (n == cap) {
+            cap = cap ? cap * 2 : 1024;
+            jobs = realloc(jobs, sizeof(Job) * cap);
+        }
+        got = parse_trace_line(path, ++line_no, line, n + 1, &jobs[n]);
+        if (got < 0) {
+            free(jobs);
+            fclose(f);
+            return -1;
+        }
+        n += got;
+    }
+    fclose(f);
+    if (n == 0) {
+        fprintf(stderr, "%s: no jobs\n", path);
+        free(jobs);
+        return -1;
+    }
+    *out = jobs;
+    return n;
+}
+
+// The same trace read one job at a time, for runs that never hold the
+// whole workload.  Jobs must appear in arrival order.
+typedef struct {
+    FILE *in;
+    const char *path;
+    int line_no;
+    long long read;                // jobs read so far
+    Job next;                      // read ahead: the next job to arrive
+    int has_next;
+    int error;
+} JobStream;
+
+// Read the next job into s->next; has_next is 0 at the end or on error
+static inline void stream_advance(JobStream *s) {
+    char line[512];
+
+    s->has_next = 0;
+    while (!s->error && fgets(line, sizeof(line), s->in)) {
+        int prev = s->read > 0 ? s->next.arrival_time : 0;
+        int got = parse_trace_line(s->path, ++s->line_no, line, (int)(s->read + 1), &s->next);
+
+        if (got < 0) {
+            s->error = 1;
+        } else if (got > 0) {
+            if (s->read > 0 && s->next.arrival_time < prev) {
+                fprintf(stderr, "%s:%d: arrivals must not decrease when streaming\n", s->path, s->line_no);
+                s->error = 1;
+                break;
+            }
+            s->read++;
+            s->has_next = 1;
+            return;
+        }
+    }
+}
+
+static inline int stream_open(JobStream *s, const char *path) {
+    memset(s, 0, sizeof(*s));
+    s->path = path;
+    if (!(s->in = fopen(path, "r"))) {
+        perror(path);
+        return -1;
+    }
+    stream_advance(s);
+    if (!s->has_next) {
+        if (!s->error) fprintf(stderr, "%s: no jobs\n", path);
+        fclose(s->in);
+        return -1;
+    }
+    return 0;
+}
+
+static inline void stream_close(JobStream *s) {
+    if (s->in) fclose(s->in);
+    s->in = NULL;
+}
+
+// Whether any job in the trace belongs to `group`.  A streamed run uses it
+// to check --weights before its jobs arrive; it reads the file once more
+// and keeps nothing, so memory stays bounded.
+static inline int trace_has_group(const char *path, const char *group) {
+    FILE *f = fopen(path, "r");
+    char line[512], name[20], type[50], found[50];
+    int arrival, burst, priority, memory, has = 0;
+
+    if (!f) return 0;
+    while (!has && fgets(line, sizeof(line), f)) {
+        if (line[0] == '#') continue;
+        if (sscanf(line, " %19[^,],%49[^,],%d,%d,%d,%d", name, type, &arrival, &burst,
+                   &priority, &memory) != 6) continue;
+        type_group(type, found);
+        has = strcmp(found, group) == 0;
+    }
+    fclose(f);
+    return has;
+}
+
+// ─────────────────────────────────────────────────────────
+// Job dependencies
+//
+// A DAG over job indices, stored as successor lists in CSR form: the
+// successors of job i are succ[succ_start[i] .. succ_start[i + 1] - 1].
+// topo is a topological order, found while checking for cycles.
+// ─────────────────────────────────────────────────────────
+
+typedef struct {
+    int n;
+    int n_edges;
+    int *succ_start;
+    int *succ;
+    int *indegree;
+    int *topo;
+} Dag;
+
+static inline void dag_free(Dag *dag) {
+    free(dag->succ_start);
+    free(dag->succ);
+    free(dag->indegree);
+    free(dag->topo);
+    memset(dag, 0, sizeof(*dag));
+}
+
+// Build from an edge list (from[k] must finish before to[k] starts).
+// Returns -1 if the edges contain a cycle.
+static inline int dag_build(Dag *dag, int n, const int from[], const int to[], int n_edges) {
+    int *fill, *pending, head = 0, tail = 0;
+
+    dag->n = n;
+    dag->n_edges = n_edges;
+    dag->succ_start = calloc(n + 1, sizeof(int));
+    dag->succ = malloc(sizeof(int) * (n_edges > 0 ? n_edges : 1));
+    dag->indegree = calloc(n, sizeof(int));
+    dag->topo = malloc(sizeof(int) * n);
+
+    for (int k = 0; k < n_edges; k++) {
+        dag->succ_start[from[k] + 1]++;
+        dag->indegree[to[k]]++;
+    }
+    for (int i = 0; i < n; i++) dag->succ_start[i + 1] += dag->succ_start[i];
+    fill = malloc(sizeof(int) * n);
+    memcpy(fill, dag->succ_start, sizeof(int) * n);
+    for (int k = 0; k < n_edges; k++) dag->succ[fill[from[k]]++] = to[k];
+    free(fill);
+
+    // Kahn's algorithm: the order doubles as the cycle check
+    pending = malloc(sizeof(int) * n);
+    memcpy(pending, dag->indegree, sizeof(int) * n);
+    for (int i = 0; i < n; i++) {
+        if (pending[i] == 0) dag->topo[tail++] = i;
+    }
+    while (head < tail) {
+        int u = dag->topo[head++];
+        for (int k = dag->succ_start[u]; k < dag->succ_start[u + 1]; k++) {
+            if (--pending[dag->succ[k]] == 0) dag->topo[tail++] = dag->succ[k];
+        }
+    }
+    free(pending);
+    if (tail < n) {
+        dag_free(dag);
+        return -1;
+    }
+    return 0;
+}
+
+// Upward rank (HEFT rank_u on one CPU): a job's own CPU and I/O time plus
+// the longest chain of successors after it.  The largest rank is the
+// critical path length, a lower bound on the makespan.
+static inline void dag_upward_rank(const Dag *dag, const Job jobs[], int rank[]) {
+    for (int t = dag->n - 1; t >= 0; t--) {
+        int u = dag->topo[t], longest = 0;
+        for (int k = dag->succ_start[u]; k < dag->succ_start[u + 1]; k++) {
+            if (rank[dag->succ[k]] > longest) longest = rank[dag->succ[k]];
+        }
+        rank[u] = jobs[u].burst_time + jobs[u].io_time + longest;
+    }
+}
+
+// The built-in pipeline: reports and data processing read what the
+// database query and the batch analytics produce.
+// P9 needs P1 and P5; P10 needs P3 and P5.
+static inline int dag_builtin(Dag *dag, int n) {
+    static const int from[] = {0, 4, 2, 4};
+    static const int to[] = {8, 8, 9, 9};
+    return dag_build(dag, n, from, to, 4);
+}
+
+// Edge file: one "pred,succ" pair of 1-based job numbers per line
+static inline int load_deps(const char *path, int n, Dag *dag) {
+    FILE *f = fopen(path, "r");
+    char line[128];
+    int *from = NULL, *to = NULL, m = 0, cap = 0, line_no = 0, rc;
+
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        int a, b;
+
+        line_no++;
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') continue;
+        if (sscanf(line, " %d , %d", &a, &b) != 2) {
+            if (m == 0 && line_no == 1) continue;      // header
+            fprintf(stderr, "%s:%d: expected pred,succ\n", path, line_no);
+            free(from);
+            free(to);
+            fclose(f);
+            return -1;
+        }
+        if (a < 1 || a > n || b < 1 || b > n || a == b) {
+            fprintf(stderr, "%s:%d: job numbers must be distinct and in 1..%d\n", path, line_no, n);
+            free(from);
+            free(to);
+            fclose(f);
+            return -1;
+        }
+        if (m == cap) {
+            cap = cap ? cap * 2 : 1024;
+            from = realloc(from, sizeof(int) * cap);
+            to = realloc(to, sizeof(int) * cap);
+        }
+        from[m] = a - 1;
+        to[m] = b - 1;
+        m++;
+    }
+    fclose(f);
+    rc = dag_build(dag, n, from, to, m);
+    if (rc != 0) fprintf(stderr, "%s: dependencies contain a cycle\n", path);
+    free(from);
+    free(to);
+    return rc;
+}
+
+static inline void print_process_table(const Job jobs[], const JobState state[], int n) {
+    printf("\n\nProcess Execution Table:\n");
+    printf("========================================================================================================\n");
+    printf("PID  Name  Type                           AT  BT  Pri  Mem   Swap?  SwapT  CT   TAT  WT   RT\n");
+    printf("========================================================================================================\n");
+
+    for (int i = 0; i < n; i++) {
+        printf("%-4d %-5s %-30s %-3d %-3d %-4d %-5d %-6s %-6d %-4d %-4d %-4d %-4d\n",
+               jobs[i].pid, jobs[i].name, jobs[i].type, jobs[i].arrival_time,
+               jobs[i].burst_time, jobs[i].priority, jobs[i].memory_required,
+               state[i].is_swapped ? "Yes" : "No",
+               state[i].total_swap_time, state[i].completion_time,
+               state[i].turnaround_time, state[i].waiting_time,
+               state[i].response_time);
+    }
+    printf("========================================================================================================\n");
+}
+
+// One box per CPU slice; swap and idle gaps are not drawn
+static inline void print_gantt_chart(const Job jobs[], const Slice slices[], int n_slices) {
+    int i, j;
+
+    printf("\n\nGantt Chart:\n");
+    printf("=================================\n");
+
+    for (i = 0; i < n_slices; i++) {
+        printf("+");
+        for (j = 0; j < slices[i].end - slices[i].start; j++) printf("--");
+    }
+    printf("+\n");
+
+    for (i = 0; i < n_slices; i++) {
+        const char *name = jobs[slices[i].job].name;
+        int padding = (slices[i].end - slices[i].start) * 2 - (int)strlen(name);
+        printf("|");
+        for (j = 0; j < padding / 2; j++) printf(" ");
+        printf("%s", name);
+        for (j = 0; j < (padding + 1) / 2; j++) printf(" ");
+    }
+    printf("|\n");
+
+    for (i = 0; i < n_slices; i++) {
+        printf("+");
+        for (j = 0; j < slices[i].end - slices[i].start; j++) printf("--");
+    }
+    printf("+\n");
+
+    printf("%d", n_slices > 0 ? slices[0].start : 0);
+    for (i = 0; i < n_slices; i++) {
+        char end[16];
+        int len = sprintf(end, "%d", slices[i].end);
+        int width = (slices[i].end - slices[i].start) * 2 + 1 - len;
+        for (j = 0; j < width; j++) printf(" ");
+        printf("%s", end);
+    }
+    printf("\n");
+}
+
+// Totals over the jobs that ran; rejected jobs are left out
+typedef struct {
+    int served;
+    long long total_wt;
+    long long total_tat;
+    long long total_rt;
+    long long total_burst;
+    long long total_swap_time;
+    int makespan;
+    int swapped;
+} RunSummary;
+
+static inline void summarize_run(const Job jobs[], const JobState state[], int n, RunSummary *sum) {
+    memset(sum, 0, sizeof(*sum));
+    for (int i = 0; i < n; i++) {
+        if (state[i].rejected) continue;
+        sum->served++;
+        sum->total_wt += state[i].waiting_time;
+        sum->total_tat += state[i].turnaround_time;
+        sum->total_rt += state[i].response_time;
+        sum->total_burst += jobs[i].burst_time;
+        sum->total_swap_time += state[i].total_swap_time;
+        if (state[i].completion_time > sum->makespan) sum->makespan = state[i].completion_time;
+        if (state[i].is_swapped) sum->swapped++;
+    }
+}
+
+static inline void print_performance_metrics(const Job jobs[], const JobState state[], int n,
+                                             const RunStats *stats, double exec_time) {
+    RunSummary sum;
+
+    summarize_run(jobs, state, n, &sum);
+    // Every job may have been rejected, leaving nothing served and no makespan
+    double served = sum.served > 0 ? (double)sum.served : 1;
+    double makespan = sum.makespan > 0 ? (double)sum.makespan : 1;
+    double avg_wt = sum.total_wt / served;
+    double avg_tat = sum.total_tat / served;
+    double avg_rt = sum.total_rt / served;
+    double throughput = sum.served / makespan;
+    double cpu_util = (sum.total_burst / makespan) * 100;
+    int overhead = stats->switch_overhead + stats->cache_overhead;
+
+    printf("\n\nPerformance Metrics:\n");
+    printf("========================================\n");
+    printf("Average Waiting Time       : %.2f units\n", avg_wt);
+    printf("Average Turnaround Time    : %.2f units\n", avg_tat);
+    printf("Average Response Time      : %.2f units\n", avg_rt);
+    printf("Throughput                 : %.4f processes/unit\n", throughput);
+    printf("CPU Utilization            : %.2f%%\n", cpu_util);
+    printf("CPU Busy (incl. overhead)  : %.2f%%\n", ((sum.total_burst + overhead) / makespan) * 100);
+    printf("Context Switches           : %d\n", stats->context_switches);
+    printf("Preemptions                : %d\n", stats->preemptions);
+    printf("Switch Overhead            : %d units\n", stats->switch_overhead);
+    printf("Cache Rewarm Overhead      : %d units\n", stats->cache_overhead);
+    printf("Total Execution Time       : %d units\n", sum.makespan);
+    printf("Total Swap Time            : %lld units\n", sum.total_swap_time);
+    printf("Processes Swapped Out      : %d\n", sum.swapped);
+    printf("Memory Waits               : %d\n", stats->memory_waits);
+    printf("Memory Stall Time          : %lld units\n", stats->memory_stall);
+    if (stats->io_operations > 0) {
+        printf("I/O Operations             : %d\n", stats->io_operations);
+        for (int d = 0; d < stats->n_devices; d++) {
+            printf("Device %d Utilization       : %.2f%%\n", d,
+                   stats->device_busy[d] / makespan * 100);
+        }
+    }
+    printf("Program Execution Time     : %.6f seconds\n", exec_time);
+    printf("========================================\n");
+}
+
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of a sorted array
+static inline int percentile(const int sorted[], int n, int pct) {
+    int rank = (int)(((long long)pct * n + 99) / 100);   // pct * n overflows an int past ~21M jobs
+    return n == 0 ? 0 : sorted[rank > 0 ? rank - 1 : 0];
+}
+
+// Deadline misses and tardiness (completion past the deadline, 0 when met)
+// over the jobs that have a deadline; rejected jobs count as misses
+static inline void print_deadline_report(const Job jobs[], const JobState state[], int n,
+                                         const RunStats *stats) {
+    int *tardiness = malloc(sizeof(int) * n);
+    int with_deadline = 0, ran = 0, missed = 0, rejected = 0;
+    long long total_tardiness = 0;
+
+    for (int i = 0; i < n; i++) {
+        if (jobs[i].deadline == NO_DEADLINE) continue;
+        with_deadline++;
+        if (state[i].rejected) {
+            rejected++;
+            continue;
+        }
+        tardiness[ran] = state[i].completion_time > jobs[i].deadline ?
+                         state[i].completion_time - jobs[i].deadline : 0;
+        if (tardiness[ran] > 0) missed++;
+        total_tardiness += tardiness[ran];
+        ran++;
+    }
+    qsort(tardiness, ran, sizeof(int), compare_int);
+
+    printf("\n\nDeadline Report:\n");
+    printf("========================================\n");
+    if (n <= MAX_PROCESSES) {
+        for (int i = 0; i < n; i++) {
+            if (jobs[i].deadline == NO_DEADLINE) continue;
+            printf("  %-4s %-30s DL %-4d ", jobs[i].name, jobs[i].type, jobs[i].deadline);
+            if (state[i].rejected) printf("rejected\n");
+            else printf("CT %-4d %s%s\n", state[i].completion_time,
+                        state[i].completion_time > jobs[i].deadline ? "MISSED" : "met",
+                        state[i].deferred ? " (deferred)" : "");
+        }
+        printf("----------------------------------------\n");
+    }
+    printf("Jobs With Deadlines        : %d\n", with_deadline);
+    printf("Deadlines Met              : %d\n", ran - missed);
+    printf("Deadlines Missed           : %d\n", missed);
+    printf("Rejected by Admission      : %d\n", rejected);
+    printf("Deferred by Admission      : %d\n", stats->deferred);
+    printf("Deadline Miss Ratio        : %.2f%%\n",
+           with_deadline ? (double)(missed + rejected) / with_deadline * 100 : 0.0);
+    printf("Average Tardiness          : %.2f units\n", ran ? (double)total_tardiness / ran : 0.0);
+    printf("Tardiness p50 / p95 / p99  : %d / %d / %d units\n", percentile(tardiness, ran, 50),
+           percentile(tardiness, ran, 95), percentile(tardiness, ran, 99));
+    printf("Maximum Tardiness          : %d units\n", ran ? tardiness[ran - 1] : 0);
+    printf("========================================\n");
+    free(tardiness);
+}
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef TIMING_WHEEL_H
+#define TIMING_WHEEL_H
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WHEEL_BITS 6
+#define WHEEL_SLOTS (1 << WHEEL_BITS)
+#define WHEEL_LEVELS 6                 // 36 bits of time: every non-negative int
+
+// ─────────────────────────────────────────────────────────
+// Hierarchical timing wheel
+//
+// Pending timers for ids 0..capacity-1, at most one per id.  Level L has
+// 64 slots, each covering 64^L time units.  A timer sits on the highest
+// level at which its time differs from `now`, in the slot of its digit
+// there, so inserting is a shift and a list push.  When `now` moves into
+// a coarse slot, that slot's timers are re-inserted on finer levels; a
+// timer moves at most once per level, so insert and expire are O(1)
+// amortised however many timers are pending.  Per-level occupancy
+// bitmaps find the earliest non-empty slot without scanning empty ones.
+//
+// Slot lists are FIFO and cascading keeps their order, so timers due at
+// the same time expire in the order they were inserted.
+// ─────────────────────────────────────────────────────────
+
+typedef struct {
+    int now;                           // no pending timer is earlier
+    int count;
+    int *next;                         // per id: next timer in the same slot, -1 ends
+    int *time;                         // per id: expiry time
+    int head[WHEEL_LEVELS][WHEEL_SLOTS];
+    int tail[WHEEL_LEVELS][WHEEL_SLOTS];
+    unsigned long long used[WHEEL_LEVELS];  // bit s: slot s is non-empty
+    int earliest;                      // cached earliest expiry
+    int earliest_known;
+} TimingWheel;
+
+static inline int wheel_top_bit(unsigned x) {
+#if defined(__GNUC__)
+    return 31 - __builtin_clz(x);
+#else
+    int bit = 0;
+    while (x >>= 1) bit++;
+    return bit;
+#endif
+}
+
+static inline int wheel_low_bit(unsigned long long x) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(x);
+#else
+    int bit = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+static inline void wheel_init(TimingWheel *w, int capacity, int now) {
+    memset(w, 0, sizeof(*w));
+    w->now = now;
+    w->next = malloc(sizeof(int) * capacity);
+    w->time = malloc(sizeof(int) * capacity);
+    memset(w->head, -1, sizeof(w->head));
+}
+
+static inline void wheel_free(TimingWheel *w) {
+    free(w->next);
+    free(w->time);
+    memset(w, 0, sizeof(*w));
+}
+
+// Put a timer in its slot relative to now; times before now are due now
+static inline void wheel_place(TimingWheel *w, int id) {
+    int time = w->time[id], level = 0, slot;
+
+    if (time > w->now) level = wheel_top_bit((unsigned)time ^ (unsigned)w->now) / WHEEL_BITS;
+    else time = w->time[id] = w->now;
+    slot = (int)(((unsigned long long)time >> (level * WHEEL_BITS)) & (WHEEL_SLOTS - 1));
+    w->next[id] = -1;
+    if (w->head[level][slot] < 0) w->head[level][slot] = id;
+    else w->next[w->tail[level][slot]] = id;
+    w->tail[level][slot] = id;
+    w->used[level] |= 1ULL << slot;
+}
+
+static inline void wheel_insert(TimingWheel *w, int id, int time) {
+    w->time[id] = time;
+    wheel_place(w, id);
+    if (w->count++ == 0) {
+        w->earliest = w->time[id];
+        w->earliest_known = 1;
+    } else if (w->earliest_known && w->time[id] < w->earliest) {
+        w->earliest = w->time[id];
+    }
+}
+
+// Earliest pending expiry, INT_MAX if none.  The first non-empty slot on
+// the lowest non-empty level holds it.  A level-0 slot is one time unit;
+// a coarser one is scanned, and is cascaded by the pop that follows.
+static inline int wheel_earliest(TimingWheel *w) {
+    if (w->count == 0) return INT_MAX;
+    if (!w->earliest_known) {
+        if (w->used[0]) {
+            w->earliest = (w->now & ~(WHEEL_SLOTS - 1)) | wheel_low_bit(w->used[0]);
+        } else {
+            for (int level = 1; level < WHEEL_LEVELS; level++) {
+                if (w->used[level]) {
+                    int best = INT_MAX;
+                    for (int id = w->head[level][wheel_low_bit(w->used[level])]; id >= 0; id = w->next[id]) {
+                        if (w->time[id] < best) best = w->time[id];
+                    }
+                    w->earliest = best;
+                    break;
+                }
+            }
+        }
+        w->earliest_known = 1;
+    }
+    return w->earliest;
+}
+
+// Move now forward to `time`, which must not pass a pending timer.  Only
+// the slot `time` enters on the highest changed level can hold timers;
+// they are redistributed to finer levels.
+static inline void wheel_advance(TimingWheel *w, int time) {
+    int top;
+
+    if (time <= w->now) return;
+    top = wheel_top_bit((unsigned)time ^ (unsigned)w->now) / WHEEL_BITS;
+    w->now = time;
+    for (int level = top; level >= 1; level--) {
+        int slot = (int)(((unsigned long long)time >> (level * WHEEL_BITS)) & (WHEEL_SLOTS - 1));
+        int id = w->head[level][slot];
+
+        if (id < 0) continue;
+        w->head[level][slot] = -1;
+        w->used[level] &= ~(1ULL << slot);
+        while (id >= 0) {
+            int next = w->next[id];
+            wheel_place(w, id);
+            id = next;
+        }
+    }
+}
+
+// Remove and return the timer that expires first (ties: first inserted),
+// or -1 if none is pending.  Now moves to its expiry time.
+static inline int wheel_pop(TimingWheel *w) {
+    int slot, id;
+
+    if (w->count == 0) return -1;
+    wheel_advance(w, wheel_earliest(w));
+    slot = w->now & (WHEEL_SLOTS - 1);
+    id = w->head[0][slot];
+    w->head[0][slot] = w->next[id];
+    if (w->head[0][slot] < 0) w->used[0] &= ~(1ULL << slot);
+    w->count--;
+    w->earliest_known = w->head[0][slot] >= 0;     // more due at the same time
+    return id;
+}
+
+#endif